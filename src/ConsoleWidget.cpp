@@ -0,0 +1,255 @@
+#include "ConsoleWidget.h"
+
+/**
+ * @brief Construct a new ConsoleWidget object.
+ *
+ * @param depth number of lines in the history (1..CONSOLE_MAX_DEPTH). The lines are stored in the textArena
+ */
+ConsoleWidget::ConsoleWidget(uint8_t depth)
+    : Widget(DisplayMode::CONSOLE), _depth(MIN(MAX(depth, 1), CONSOLE_MAX_DEPTH))
+{
+    _lines = new TextArena::Handle[_depth];
+    for (uint8_t i = 0; i < _depth; i++)
+    {
+        _lines[i] = TextArena::NONE;
+    }
+}
+
+/**
+ * @brief Destroy the ConsoleWidget object. The lines are freed and the textArena is compacted.
+ */
+ConsoleWidget::~ConsoleWidget()
+{
+    for (uint8_t i = 0; i < _depth; i++)
+    {
+        textArena.release(_lines[i]);
+    }
+    delete[] _lines;
+    textArena.compact();
+}
+
+/**
+ * @brief Append a line at the end of the history. If the history is full or the new line would exceed
+ *        CONSOLE_ARENA_BUDGET, the oldest lines are dropped. If the view is scrolled back, it stays on the same lines.
+ *
+ * @param line the text of the line. Cut after CONSOLE_MAX_CHARS characters
+ */
+void ConsoleWidget::appendLine(const char *line)
+{
+    const uint16_t len = strnlen(line, CONSOLE_MAX_CHARS);
+    while (_count > 0 && (_count == _depth || _bytes + TextArena::blockSize(len) > CONSOLE_ARENA_BUDGET))
+    {
+        dropOldest();
+    }
+
+    TextArena::Handle &handle = _lines[(_head + _count) % _depth];
+    textArena.set(handle, line, len);
+    _bytes += textArena.footprint(handle);
+    _count++;
+    _total++;
+
+    if (_scrollBack > 0) _scrollBack = MIN(_scrollBack + 1, maxScrollBack()); // Keep the view
+}
+
+/**
+ * @brief Remove the oldest line from the history and free its text.
+ */
+void ConsoleWidget::dropOldest()
+{
+    _bytes -= textArena.footprint(_lines[_head]);
+    textArena.release(_lines[_head]);
+    _head = (_head + 1) % _depth;
+    _count--;
+}
+
+/**
+ * @brief Remove all lines from the history.
+ */
+void ConsoleWidget::clear()
+{
+    for (uint8_t i = 0; i < _depth; i++)
+    {
+        textArena.release(_lines[i]);
+    }
+    _head = 0;
+    _count = 0;
+    _bytes = 0;
+    _scrollBack = 0;
+    _redraw = true;
+}
+
+/**
+ * @brief Scroll back into the history.
+ *
+ * @param lines number of lines to scroll
+ */
+void ConsoleWidget::scrollUp(uint8_t lines)
+{
+    _scrollBack = MIN(_scrollBack + lines, maxScrollBack());
+}
+
+/**
+ * @brief Scroll forward to the newest line.
+ *
+ * @param lines number of lines to scroll
+ */
+void ConsoleWidget::scrollDown(uint8_t lines)
+{
+    _scrollBack = (_scrollBack > lines) ? _scrollBack - lines : 0;
+}
+
+/**
+ * @brief Maximum number of lines to scroll back, so the screen is still filled with lines.
+ */
+uint8_t ConsoleWidget::maxScrollBack() const
+{
+    return (_count > _rows) ? _count - _rows : 0;
+}
+
+/**
+ * @brief Get the sequence number of the top visible line. Until the screen is filled, the lines start at the top.
+ */
+uint32_t ConsoleWidget::topLine() const
+{
+    const uint32_t oldest = _total - _count;
+    return oldest + ((_count > _rows) ? _count - _rows - MIN(_scrollBack, maxScrollBack()) : 0);
+}
+
+/**
+ * @brief Get the text of a line.
+ *
+ * @param line sequence number of the line. Must be in the history
+ */
+const char *ConsoleWidget::lineText(uint32_t line) const
+{
+    return textArena.get(_lines[(_head + (line - (_total - _count))) % _depth]);
+}
+
+/**
+ * @brief Get the first visible character of a line. Lines which fit into the row are not scrolled, the others pause
+ *        at the start for CONSOLE_SCROLL_PAUSE steps and then scroll to their end.
+ *
+ * @param len length of the line
+ * @param maxChars visible characters in a row
+ * @param step the scroll step
+ */
+uint16_t ConsoleWidget::scrollOffset(uint16_t len, uint16_t maxChars, uint32_t step) const
+{
+    if (len <= maxChars) return 0;
+
+    const uint32_t phase = step % (len - maxChars + 1 + CONSOLE_SCROLL_PAUSE);
+    return (phase < CONSOLE_SCROLL_PAUSE) ? 0 : phase - CONSOLE_SCROLL_PAUSE;
+}
+
+/**
+ * @brief Draw a line into a row of the framebuffer. The row (one page) is cleared first. A line wider than the
+ *        display is drawn from its current scroll offset.
+ *
+ * @param gfx pointer to the display object
+ * @param row the row on the display
+ * @param line sequence number of the line
+ */
+void ConsoleWidget::drawRow(Adafruit_SSD1306 *gfx, uint8_t row, uint32_t line)
+{
+    const uint16_t maxChars = gfx->width() / FastText::GLYPH_WIDTH;
+    const char *text = lineText(line);
+    const uint16_t textLen = strlen(text);
+    const uint16_t offset = scrollOffset(textLen, maxChars, _scrollStep);
+    const uint16_t len = MIN(textLen - offset, maxChars);
+    const int16_t y = row * FastText::GLYPH_HEIGHT;
+
+    text += offset;
+    memset(gfx->getBuffer() + row * gfx->width(), 0, gfx->width());
+#ifndef SUPPORT_UMALAUTS
+    if (FastText::drawText(gfx, 0, y, text, len, SSD1306_WHITE, SSD1306_BLACK)) return;
+#endif
+    gfx->setCursor(0, y);
+    gfx->setTextSize(1);
+    gfx->setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+    for (uint16_t i = 0; i < len; i++)
+    {
+        const char c = (text[i] == '\n' || text[i] == '\r') ? ' ' : text[i]; // Stay in the row
+#ifdef SUPPORT_UMALAUTS
+        gfx->write(convertCharToCP437(static_cast<uint8_t>(c)));
+#else
+        gfx->write(c);
+#endif
+    }
+}
+
+/**
+ * @brief Draw the visible lines. If the view has moved by less than a screen, the rows in the framebuffer are
+ *        moved and only the new rows and the scrolling long lines are drawn. Only the changed rows are sent to the display.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void ConsoleWidget::drawWidget(i2cDisplay *display)
+{
+    Adafruit_SSD1306 *gfx = display->display;
+    if (gfx->getRotation() != 0) return; // Rows are pages of the framebuffer
+
+    _rows = gfx->height() / FastText::GLYPH_HEIGHT;
+    gfx->cp437(true); // Use CP437 character encoding
+
+    const uint32_t top = topLine();
+    const uint8_t visibleRows = MIN(_count, _rows);
+    const int32_t delta = (int32_t)(top - _drawnTop); // Lines the view has moved down
+    uint8_t *buffer = gfx->getBuffer();
+    const uint16_t pitch = gfx->width();
+
+    uint8_t validFrom = 0, validTo = 0; // Rows which still show the right line
+    if (display->claim(this) || _redraw || delta >= _rows || -delta >= _rows)
+    {
+        memset(buffer, 0, _rows * pitch);
+        display->markDirty(0, 0, gfx->width(), gfx->height());
+    }
+    else if (delta > 0) // Move the rows up
+    {
+        memmove(buffer, buffer + delta * pitch, (_rows - delta) * pitch);
+        memset(buffer + (_rows - delta) * pitch, 0, delta * pitch);
+        validTo = (_drawnRows > delta) ? _drawnRows - delta : 0;
+        display->markDirty(0, 0, gfx->width(), gfx->height());
+    }
+    else if (delta < 0) // Move the rows down
+    {
+        memmove(buffer - delta * pitch, buffer, (_rows + delta) * pitch);
+        memset(buffer, 0, -delta * pitch);
+        validFrom = -delta;
+        validTo = MIN(_drawnRows - delta, _rows);
+        display->markDirty(0, 0, gfx->width(), gfx->height());
+    }
+    else if (visibleRows == _drawnRows && millis() - _lastScrollTime < CONSOLE_SCROLL_DELAY)
+    {
+        return; // Nothing has changed
+    }
+    else
+    {
+        validTo = _drawnRows;
+    }
+
+    // Long lines move by one character per step. Only their rows are drawn again
+    const uint32_t now = millis();
+    const bool scrolled = (now - _lastScrollTime >= CONSOLE_SCROLL_DELAY);
+    if (scrolled)
+    {
+        _scrollStep++;
+        _lastScrollTime = now;
+    }
+    const uint16_t maxChars = gfx->width() / FastText::GLYPH_WIDTH;
+
+    for (uint8_t row = 0; row < visibleRows; row++)
+    {
+        if (row >= validFrom && row < validTo)
+        {
+            const uint16_t len = scrolled ? strlen(lineText(top + row)) : 0;
+            if (scrollOffset(len, maxChars, _scrollStep) == scrollOffset(len, maxChars, _scrollStep - 1)) continue; // Not moved
+        }
+        drawRow(gfx, row, top + row);
+        display->markDirty(0, row * FastText::GLYPH_HEIGHT, gfx->width(), FastText::GLYPH_HEIGHT);
+    }
+
+    _drawnTop = top;
+    _drawnRows = visibleRows;
+    _redraw = false;
+    display->displayDirty();
+}
@@ -0,0 +1,80 @@
+#pragma once
+/**
+ * @file        ConsoleWidget.h
+ * @brief       Console widget with a ring buffer of lines and scrollback
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * The lines are kept in a ring buffer of handles into the textArena. Appending a line only stores the new text
+ * and drops the oldest one if the ring is full, nothing else is copied. The lines of a console use at most
+ * CONSOLE_ARENA_BUDGET bytes of the textArena incl. the block headers, older lines are dropped to stay below. So the
+ * history holds fewer lines than its depth if the lines are long. The depth is limited to CONSOLE_MAX_DEPTH, so a
+ * console leaves enough handles of the textArena for the other widgets.
+ * Every line is one page (8 pixel rows) of the display with the built-in font. If the view moves by some lines,
+ * the pages in the framebuffer are moved and only the lines which became visible are drawn.
+ * The view can be scrolled back into the history with scrollUp()/pageUp() and forward with scrollDown()/pageDown().
+ * Lines longer than the display width scroll horizontally like the scrolling lines of the TextWidget: they pause at
+ * the start, then move by one character every CONSOLE_SCROLL_DELAY. Only these rows are redrawn when they move.
+ */
+#include "Widget.h"
+#include "TextArena.h"
+
+#define CONSOLE_DEFAULT_DEPTH 32 // Default number of lines in the history
+#define CONSOLE_MAX_DEPTH 48     // Maximum number of lines in the history. Well below TEXT_ARENA_MAX_HANDLES
+#define CONSOLE_ARENA_BUDGET 768 // Maximum bytes of the textArena for the lines of one console, incl. the block headers
+#define CONSOLE_MAX_CHARS 32     // Maximum characters stored per line. Longer lines are cut, lines wider than the display scroll
+#define CONSOLE_SCROLL_DELAY 250 // Horizontal scrolling speed of long lines (in milliseconds per character)
+#define CONSOLE_SCROLL_PAUSE 8   // Scroll steps to pause at the start of a long line
+
+class ConsoleWidget : public Widget
+{
+  public:
+    ConsoleWidget(uint8_t depth = CONSOLE_DEFAULT_DEPTH); // Constructor. depth is the number of lines in the history (max. CONSOLE_MAX_DEPTH)
+    ~ConsoleWidget();                                     // Destructor. Frees the lines in the textArena
+    ConsoleWidget(const ConsoleWidget &) = delete;        // The lines in the textArena are owned by the widget
+    ConsoleWidget &operator=(const ConsoleWidget &) = delete;
+
+    // Get the console widget, if the widget is one. Otherwise nullptr
+    static inline ConsoleWidget *from(Widget *widget) { return (widget != nullptr && widget->getDisplayMode() == DisplayMode::CONSOLE) ? static_cast<ConsoleWidget *>(widget) : nullptr; }
+
+    void appendLine(const char *line); // Append a line at the end of the history
+    void clear();                      // Remove all lines
+
+    void scrollUp(uint8_t lines = 1);   // Scroll back into the history
+    void scrollDown(uint8_t lines = 1); // Scroll forward to the newest line
+    inline void pageUp() { scrollUp(_rows); }     // Scroll back by one screen
+    inline void pageDown() { scrollDown(_rows); } // Scroll forward by one screen
+    inline void scrollToEnd() { _scrollBack = 0; } // Show the newest lines
+
+    inline uint8_t lineCount() const { return _count; } // Number of lines in the history
+    inline uint8_t depth() const { return _depth; }     // Maximum number of lines in the history
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Draw the visible lines
+
+  private:
+    void dropOldest();                                                          // Remove the oldest line from the history
+    uint8_t maxScrollBack() const;                                              // Maximum lines to scroll back with the current number of lines
+    uint32_t topLine() const;                                                   // Sequence number of the top visible line
+    const char *lineText(uint32_t line) const;                                  // Text of a line by its sequence number
+    uint16_t scrollOffset(uint16_t len, uint16_t maxChars, uint32_t step) const; // First visible character of a line in a scroll step
+    void drawRow(Adafruit_SSD1306 *gfx, uint8_t row, uint32_t line);            // Draw a line into a row (page)
+
+    TextArena::Handle *_lines; // Ring buffer of the lines
+    uint8_t _depth;            // Size of the ring buffer
+    uint8_t _head = 0;         // Index of the oldest line
+    uint8_t _count = 0;        // Number of lines in the ring buffer
+    uint8_t _scrollBack = 0;   // Lines scrolled back from the newest line
+    uint8_t _rows = 8;         // Visible rows, updated when drawn
+    uint32_t _total = 0;       // Number of lines appended since the start. Sequence number of the next line
+    uint16_t _bytes = 0;       // Bytes of the textArena used by the lines, see CONSOLE_ARENA_BUDGET
+
+    // State of the drawn framebuffer
+    uint32_t _drawnTop = 0;       // Sequence number of the top line drawn
+    uint8_t _drawnRows = 0;       // Number of rows drawn with lines
+    bool _redraw = true;          // Redraw all with the next draw
+    uint32_t _scrollStep = 0;     // Horizontal scroll step of the long lines
+    uint32_t _lastScrollTime = 0; // Time of the last horizontal scroll step
+};
@@ -1,4 +1,5 @@
 #include "DeviceDisplay.h"
+#include "FastRandom.h"
 
 DeviceDisplay openknxDisplayModule;
 i2cDisplay* displayModule = new i2cDisplay();
@@ -8,7 +9,6 @@ i2cDisplay* displayModule = new i2cDisplay();
  *
  */
 DeviceDisplay::DeviceDisplay()
-    : widget() // Initialize the widget
 {
 }
 
@@ -78,19 +78,21 @@ void DeviceDisplay::init()
 void DeviceDisplay::setup(bool configured)
 {
     logDebugP("setup...");
-    displayModule.SetDisplayVCOMDetect(0x20); // Set the VCOMH regulator output
-    displayModule.SetDisplayContrast(0xFF);   // Set the contrast of the display
-    initializeWidgets();                      // Setup default widget queue
+    displayModule.SetDisplayVCOMDetect(0x20);     // Set the VCOMH regulator output
+    displayModule.SetDisplayContrast(0xFF);       // Set the contrast of the display
+    displayRandom.seed(analogRead(0) ^ micros()); // Seed the random numbers of the animations once
+    initializeWidgets();                          // Setup default widget queue
 }
 
 /**
- * @brief Process GroupObjects for the display module.
+ * @brief Process GroupObjects for the display module. The value is only stored in the slots of the bindings,
+ *        the widgets are updated once per frame in LoopWidgets(), however many telegrams arrive in between.
  *
  * @param obj, the GroupObject to process
  */
 void DeviceDisplay::processInputKo(GroupObject& obj)
 {
-    // Could be a challenge to implement ;-)
+    koBindings.update(obj);
 }
 
 /**
@@ -137,7 +139,7 @@ void DeviceDisplay::loop(bool configured)
 
         lastDisplayDimTimer_ = millis(); // Reset the display dim timer if prog mode is active
 
-        WidgetInfo* ProgMode = getWidgetInfo("ProgMode");
+        WidgetInfo* ProgMode = progModeWidgetInfo();
         if (ProgMode && ProgMode->widget != nullptr)
         {
             ProgMode->addAction(WidgetAction::InternalEnabled);
@@ -145,7 +147,7 @@ void DeviceDisplay::loop(bool configured)
     }
     else if (wasInProgMode)
     {
-        WidgetInfo* ProgMode = getWidgetInfo("ProgMode");
+        WidgetInfo* ProgMode = progModeWidgetInfo();
         if (ProgMode && ProgMode->widget != nullptr)
         {
             ProgMode->removeAction(WidgetAction::InternalEnabled);
@@ -159,7 +161,6 @@ void DeviceDisplay::loop(bool configured)
 
 #ifdef DEMO_WIDGET_CMD_TESTS
     RUNTIME_MEASURE_BEGIN(_loopDemoWidgets);
-    if (_demoWidgetSysInfo) demoSysinfoWidgetLoop(); // Demo test widgets loop
     if (_demoWidgeConsoleWidget) demoConsoleWidgetLoop();
     RUNTIME_MEASURE_END(_loopDemoWidgets);
 
@@ -193,7 +194,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         if (command.compare(4, 4, "logo") == 0) // Show the boot logo
         {
             logInfoP("BootLogo requested and will be displayed for %d seconds...", BOOT_LOGO_TIMEOUT / 1000);
-            Widget* bootLogo = new Widget(Widget::DisplayMode::BOOT_LOGO);
+            Widget* bootLogo = new BootLogoWidget();
             addWidget(bootLogo, BOOT_LOGO_TIMEOUT, "BootLogo",
                       DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                           DeviceDisplay::WidgetAction::AutoRemoveFlag |  // Remove this widget after display
@@ -205,7 +206,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(6, 1, "s") == 0) // Set Matrix Screensaver
             {
-                Widget* srvMatrix = new Widget(Widget::DisplayMode::SCREEN_SAVER);
+                Widget* srvMatrix = new MatrixScreensaver();
                 addWidget(srvMatrix, 10000, "srvMatrix", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                              DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                              DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -223,7 +224,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(10, 1, "s") == 0) // Set Clock Screensaver
             {
-                Widget* srvClock = new Widget(Widget::DisplayMode::SCREEN_SAVER_CLOCK);
+                Widget* srvClock = new ClockScreensaver();
                 addWidget(srvClock, 10000, "srvClock", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                            DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                            DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -241,7 +242,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(9, 1, "s") == 0) // Set Pong Screensaver
             {
-                Widget* srvPong = new Widget(Widget::DisplayMode::SCREEN_SAVER_PONG);
+                Widget* srvPong = new PongScreensaver();
                 addWidget(srvPong, 10000, "srvPong", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                          DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                          DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -260,7 +261,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(9, 1, "s") == 0) // Set Rainfall Screensaver
             {
-                Widget* srvRain = new Widget(Widget::DisplayMode::SCREEN_SAVER_RAIN);
+                Widget* srvRain = new RainScreensaver();
                 addWidget(srvRain, 10000, "srvRain", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                          DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                          DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -279,7 +280,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(11, 1, "s") == 0) // Set Rainfall Screensaver
             {
-                Widget* srvMatrixPixel = new Widget(Widget::DisplayMode::SCREEN_SAVER_MATRIX);
+                Widget* srvMatrixPixel = new MatrixPixelScreensaver();
                 addWidget(srvMatrixPixel, 10000, "srvMaxtrixPixel", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                                         DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                                         DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -298,7 +299,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(14, 1, "s") == 0) // Set Starfield Screensaver
             {
-                Widget* srvStarfield = new Widget(Widget::DisplayMode::SCREEN_SAVER_STARFIELD);
+                Widget* srvStarfield = new StarfieldScreensaver();
                 addWidget(srvStarfield, 10000, "srvStarfield", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                                    DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                                    DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -317,7 +318,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(11, 1, "s") == 0) // Set 3D Cube Screensaver
             {
-                Widget* srv3DCube = new Widget(Widget::DisplayMode::SCREEN_SAVER_3DCUBE);
+                Widget* srv3DCube = new CubeScreensaver();
                 addWidget(srv3DCube, 10000, "srv3DCube", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                              DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                              DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -336,7 +337,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(9, 1, "s") == 0) // Set Life Screensaver
             {
-                Widget* srvLife = new Widget(Widget::DisplayMode::SCREEN_SAVER_LIFE);
+                Widget* srvLife = new LifeScreensaver();
                 addWidget(srvLife, 10000, "srvLife", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                          DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                          DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -355,7 +356,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
         {
             if (command.compare(12, 1, "s") == 0) // Set OpenKNX Team Intro
             {
-                Widget* srvOpenKNXTeam = new Widget(Widget::DisplayMode::OPENKNX_TEAM_INTRO);
+                Widget* srvOpenKNXTeam = new TeamIntroWidget();
                 addWidget(srvOpenKNXTeam, 10000, "srvOpenKNXTeam", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                                        DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                                        DeviceDisplay::WidgetAction::ExternalManaged); // This is external managed
@@ -371,14 +372,38 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
             }
         }
 #endif // MATRIX_SCREENSAVER
+        else if (command.compare(4, 8, "console ") == 0) // Scroll the console widget: ddc console <up|down|pgup|pgdn|end>
+        {
+            WidgetInfo* consoleWidgetInfo_ = getWidgetInfo("consoleWidgetInfo_");
+            ConsoleWidget* consoleWidget_ = (consoleWidgetInfo_ != nullptr) ? ConsoleWidget::from(consoleWidgetInfo_->widget) : nullptr;
+            if (consoleWidget_ == nullptr)
+            {
+                logErrorP("No console widget. Use 'ddc c <text>' first.");
+            }
+            else
+            {
+                std::string cmd = command.substr(12);
+                if (cmd == "up") consoleWidget_->scrollUp();
+                else if (cmd == "down") consoleWidget_->scrollDown();
+                else if (cmd == "pgup") consoleWidget_->pageUp();
+                else if (cmd == "pgdn") consoleWidget_->pageDown();
+                else if (cmd == "end") consoleWidget_->scrollToEnd();
+                else logErrorP("Unknown console command: %s", cmd.c_str());
+                consoleWidgetInfo_->startDisplayTime = 0;                                   // Show the console again for 30 seconds
+                consoleWidgetInfo_->action = DeviceDisplay::WidgetAction::StatusFlag |      // This is a status widget
+                                             DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
+                                             DeviceDisplay::WidgetAction::AutoRemoveFlag;   // Remove this widget after display
+            }
+            bRet = true;
+        }
         else if (command.compare(4, 1, "c") == 0) // Console simulation output widget
         {
             // Get the console widget
             WidgetInfo* consoleWidgetInfo_ = getWidgetInfo("consoleWidgetInfo_");
-            Widget* consoleWidget_ = nullptr;
+            ConsoleWidget* consoleWidget_ = nullptr;
             if (consoleWidgetInfo_ != nullptr && consoleWidgetInfo_->widget != nullptr)
             {
-                consoleWidget_ = consoleWidgetInfo_->widget;
+                consoleWidget_ = ConsoleWidget::from(consoleWidgetInfo_->widget);
                 consoleWidgetInfo_->duration = 30000;                                       // Set the duration to 30 seconds
                 consoleWidgetInfo_->action = DeviceDisplay::WidgetAction::StatusFlag |      // This is a status widget
                                              DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
@@ -389,7 +414,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
             }
             else
             {
-                consoleWidget_ = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+                consoleWidget_ = new ConsoleWidget();
                 addWidget(consoleWidget_, 30000, "consoleWidgetInfo_", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                                            DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                                            DeviceDisplay::WidgetAction::AutoRemoveFlag);  // Remove this widget after display
@@ -401,7 +426,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
                 std::string text = command.substr(6);
                 if (!text.empty())
                 {
-                    consoleWidget_->appendLine(text);
+                    consoleWidget_->appendLine(text.c_str());
                     // logInfoP("Appending text to console widget: %s", text.c_str());
                     bRet = true;
                 }
@@ -412,13 +437,40 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
             logInfoP("Total Widgets: %d:", widgetsQueue.size());
             for (size_t i = 0; i < widgetsQueue.size(); ++i)
             {
-                WidgetInfo& widgetInfo = widgetsQueue[i];
+                WidgetInfo& widgetInfo = *getWidgetInfo(widgetsQueue[i]);
                 // Try to create a table with the widget information. The columns must be aligned.
-                logInfoP("Order: %d | Name: %s | Action: %d | Duration: %d", i, widgetInfo.name.c_str(), widgetInfo.action, widgetInfo.duration);
+                logInfoP("Order: %d | Handle: 0x%04X | Name: %s | Action: %d | Duration: %d", i, widgetInfo.handle, widgetInfo.name.c_str(), widgetInfo.action, widgetInfo.duration);
             }
             logInfoP("---------------------------------------------------------");
             bRet = true;
         }
+        else if (command.compare(4, 5, "sizes") == 0) // Memory usage of the widget types
+        {
+            logInfoP("Widget sizes in bytes:");
+            logInfoP(" - TextWidget:             %d", sizeof(TextWidget));
+            logInfoP(" - ConsoleWidget:          %d", sizeof(ConsoleWidget));
+            logInfoP(" - OpenKNXLogoWidget:      %d", sizeof(OpenKNXLogoWidget));
+            logInfoP(" - BootLogoWidget:         %d", sizeof(BootLogoWidget));
+            logInfoP(" - ProgModeWidget:         %d", sizeof(ProgModeWidget));
+#ifdef QRCODE_WIDGET
+            logInfoP(" - QRCodeWidget:           %d", sizeof(QRCodeWidget));
+            logInfoP("QR code cache: %d entries of %d bytes, %d hits, %d misses", QRCODE_CACHE_SIZE, QRCodeCache::BUFFER_LEN, QRCodeCache::hits(), QRCodeCache::misses());
+#endif
+#ifdef MATRIX_SCREENSAVER
+            logInfoP(" - MatrixScreensaver:      %d", sizeof(MatrixScreensaver));
+            logInfoP(" - MatrixPixelScreensaver: %d", sizeof(MatrixPixelScreensaver));
+            logInfoP(" - ClockScreensaver:       %d", sizeof(ClockScreensaver));
+            logInfoP(" - PongScreensaver:        %d", sizeof(PongScreensaver));
+            logInfoP(" - RainScreensaver:        %d", sizeof(RainScreensaver));
+            logInfoP(" - StarfieldScreensaver:   %d", sizeof(StarfieldScreensaver));
+            logInfoP(" - CubeScreensaver:        %d", sizeof(CubeScreensaver));
+            logInfoP(" - LifeScreensaver:        %d", sizeof(LifeScreensaver));
+            logInfoP(" - TeamIntroWidget:        %d", sizeof(TeamIntroWidget));
+            logInfoP("Screensaver states (heap, taken on the first draw): %d bytes used, %d bytes peak", ScreensaverMemory::used(), ScreensaverMemory::peak());
+#endif
+            logInfoP("Text arena: %d of %d bytes used", textArena.used(), textArena.size());
+            bRet = true;
+        }
 #ifdef DD_CONSOLE_CMDS
         else if (command.compare(4, 4, "dim ") == 0) // ddc dim <on|off|0-255>
         {
@@ -640,10 +692,10 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
             }
 
             logInfoP("QR-Code requested and will be displayed and removed after %d seconds...", 15000 / 1000);
-            Widget* QRCodeWidget = new Widget(Widget::DisplayMode::QR_CODE);                 // Create a new QR code widget
-            QRCodeWidget->qrCodeWidget.setUrl(command.substr(7));                            // Set the URL for the QR code
-            QRCodeWidget->qrCodeWidget.setAlign(QRCodeWidget::QRCodeAlignPos::ALIGN_CENTER); // Set the alignment for the QR code
-            addWidget(QRCodeWidget, 15000, "Console-QRCode",
+            QRCodeWidget* qrCodeWidget = new QRCodeWidget();                    // Create a new QR code widget
+            qrCodeWidget->setUrl(command.substr(7));                            // Set the URL for the QR code
+            qrCodeWidget->setAlign(QRCodeWidget::QRCodeAlignPos::ALIGN_CENTER); // Set the alignment for the QR code
+            addWidget(qrCodeWidget, 15000, "Console-QRCode",
                       DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget. The status flag will be displayed immediately
                           DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                           DeviceDisplay::WidgetAction::AutoRemoveFlag);  // Remove this widget after display of the set duration time. Here 10sec.
@@ -676,7 +728,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
                 {
                     for (size_t i = 0; i < widgetsQueue.size(); ++i)
                     {
-                        WidgetInfo& widgetInfo = widgetsQueue[i];
+                        WidgetInfo& widgetInfo = *getWidgetInfo(widgetsQueue[i]);
                         widgetInfo.widget->_WidgetRutimeStat.showStat("widget_" + widgetInfo.name, 0, true, true);
                     }
                     bRet = true;
@@ -745,6 +797,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
             openknx.logger.color(0);
             openknx.logger.log("Command(s)               Description");
             openknx.console.printHelpLine("ddc c <text>", "Print/Update Console Widget");
+            openknx.console.printHelpLine("ddc console <cmd>", "<up|down|pgup|pgdn|end> Scroll the Console Widget");
 #ifdef DD_CONSOLE_CMDS
             openknx.console.printHelpLine("ddc scroll <cmd>", "<r|l|dr|dl|start|stop|sa> Scroll the display");
             openknx.console.printHelpLine("ddc vcom <on|off|value>", "Enable or disable VCOM detect or set the value");
@@ -760,6 +813,7 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
             openknx.console.printHelpLine("ddc test_stop", "Stop the demo test widgets");
 #endif // DEMO_WIDGET_CMD_TESTS
             openknx.console.printHelpLine("ddc l", "List all widgets");
+            openknx.console.printHelpLine("ddc sizes", "Show the memory usage of the widget types");
             openknx.console.printHelpLine("ddc logo", "Show the boot logo");
 #ifdef MATRIX_SCREENSAVER
             openknx.console.printHelpLine("ddc m <s|r>", "<s> set, <r> remove - Matrix Screensaver ");
@@ -808,17 +862,17 @@ bool DeviceDisplay::processCommand(const std::string command, bool diagnose)
 void DeviceDisplay::initializeWidgets()
 {
     // Bootlogo widget! The boot logo will be displayed immediately and removed after the set duration
-    Widget* bootLogo = new Widget(Widget::DisplayMode::BOOT_LOGO);
+    Widget* bootLogo = new BootLogoWidget();
     addWidget(bootLogo, BOOT_LOGO_TIMEOUT, "BootLogo", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
                                                            DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                                                            DeviceDisplay::WidgetAction::AutoRemoveFlag);  // Remove this widget after display
 
     // ProgMode widget! The ProgMode widget will be displayed if the device is in programming mode.
-    Widget* progMode = new Widget(Widget::DisplayMode::PROG_MODE);
-    addWidget(progMode, PROG_MODE_BLINK_DELAY, "ProgMode", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
-                                                               DeviceDisplay::WidgetAction::ExternalManaged); // This widget is initially disabled
-                                                                                                              // Add here more default widgets
-    Widget* defaultWidget = new Widget(Widget::DisplayMode::OPENKNX_LOGO);
+    Widget* progMode = new ProgModeWidget();
+    progModeWidget = addWidget(progMode, PROG_MODE_BLINK_DELAY, "ProgMode", DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget
+                                                                                DeviceDisplay::WidgetAction::ExternalManaged); // This widget is initially disabled
+                                                                                                                               // Add here more default widgets
+    Widget* defaultWidget = new OpenKNXLogoWidget();
     addWidget(defaultWidget, 3000, "defaultWidget");
 }
 
@@ -832,25 +886,81 @@ void DeviceDisplay::initializeWidgets()
  *        2 = Auto-remove: This action flag is used to display a widget only once for the given duration and then it will be removed Automatically from the queue.
  *        4 = (Internal) Internal disable: This action flag is used to disable a status widget after one display. It is used internally and should not be set manually.
  *        8 = (Internal) Marked for remove: This action flag is used to mark a widget for removal after display. It is used internally and should not be set manually.
+ * @return DeviceDisplay::WidgetHandle handle of the widget, e.g. for getWidgetInfo(). NO_WIDGET if the widget was not added
  */
-void DeviceDisplay::addWidget(Widget* widget, uint32_t duration, std::string name, uint8_t action)
+DeviceDisplay::WidgetHandle DeviceDisplay::addWidget(Widget* widget, uint32_t duration, std::string name, uint8_t action)
 {
+    if (widget == nullptr)
+    {
+        logErrorP("Widget not added to queue: %s. No widget!", name.c_str());
+        return NO_WIDGET;
+    }
+
     // Check if the widget name is already in use in the queue, if so, then add a suffix to the name
     if (name.empty())
     {
         name = "Widget" + std::to_string(widgetsQueue.size());
     }
-    for (WidgetInfo& widgetInfo : widgetsQueue)
+    if (findWidget(name) != NO_WIDGET)
+    {
+        // Add unique suffix to the name to ensure it is unique. Just use a random kombination of numbers and letters
+        name += "_" + std::to_string(random(0, 9)) + (char)random(65, 90);
+        logDebugP("Widget name already in use. Added suffix to name: %s", name.c_str());
+    }
+
+    // Reuse a free slot or append a new one. The slots are never moved, so the WidgetInfo pointers stay valid
+    size_t slot = 0;
+    while (slot < widgetSlots.size() && widgetSlots[slot].widget != nullptr) slot++;
+    if (slot > 0xFF)
     {
-        if (widgetInfo.name == name)
+        logErrorP("Widget not added to queue: %s. No free slot!", name.c_str());
+        return NO_WIDGET;
+    }
+    if (slot == widgetSlots.size()) widgetSlots.emplace_back();
+
+    uint8_t generation = (widgetSlots[slot].handle >> 8) + 1; // A handle of the previous widget in this slot is invalid now
+    if (generation == 0) generation = 1;                       // Generation 0 is reserved, so no handle is NO_WIDGET
+
+    WidgetInfo& widgetInfo = widgetSlots[slot];
+    widgetInfo = {widget, duration, name, action};
+    widgetInfo.handle = (generation << 8) | slot;
+
+    logDebugP("Added widget to queue: %s", name.c_str());
+    widgetsQueue.push_back(widgetInfo.handle);
+    return widgetInfo.handle;
+}
+
+/**
+ * @brief Remove a widget from the queue. This will also free the memory of the widget. The handle and all
+ *        WidgetInfo pointers of the widget are invalid afterwards, the other ones stay valid.
+ * @param handle the handle of the widget to remove
+ * @return true if the widget was removed, false otherwise
+ */
+bool DeviceDisplay::removeWidget(WidgetHandle handle)
+{
+    WidgetInfo* widgetInfo = getWidgetInfo(handle);
+    if (widgetInfo == nullptr) return false;
+
+    for (size_t i = 0; i < widgetsQueue.size(); ++i)
+    {
+        if (widgetsQueue[i] == handle)
         {
-            // Add unique suffix to the name to ensure it is unique. Just use a random kombination of numbers and letters
-            name += "_" + std::to_string(random(0, 9)) + (char)random(65, 90);
-            logDebugP("Widget name already in use. Added suffix to name: %s", name.c_str());
+            widgetsQueue.erase(widgetsQueue.begin() + i);
+            if (i < currentWidgetIndex) currentWidgetIndex--; // Keep the next widget in the queue
+            break;
         }
     }
-    logDebugP("Added widget to queue: %s", name.c_str());
-    widgetsQueue.push_back({widget, duration, name, action});
+    if (currentWidgetIndex >= widgetsQueue.size()) currentWidgetIndex = 0;
+    if (shownWidget == handle) shownWidget = NO_WIDGET;
+
+    logDebugP("Removed widget from queue: %s", widgetInfo->name.c_str());
+    koBindings.unbind(widgetInfo->widget);     // The group objects must not update the deleted widget
+    displayModule.release(widgetInfo->widget); // A new widget at the same address must not take over the buffer
+    delete widgetInfo->widget;                 // Free memory, since the widget is created with new!
+    widgetInfo->widget = nullptr;              // Free the slot. The handle is kept for the next generation
+    widgetInfo->name.clear();
+    widgetInfo->name.shrink_to_fit();
+    return true;
 }
 
 /**
@@ -860,36 +970,55 @@ void DeviceDisplay::addWidget(Widget* widget, uint32_t duration, std::string nam
  */
 bool DeviceDisplay::removeWidget(const std::string& name)
 {
-    for (std::vector<WidgetInfo>::iterator it = widgetsQueue.begin(); it != widgetsQueue.end(); ++it)
-    {
-        if (it->name == name)
-        {
-            logDebugP("Removed widget from queue: %s", name.c_str());
-            delete it->widget;      // Free memory, since the widget is created with new!
-            widgetsQueue.erase(it); // Remove the widget from the queue list by name
+    if (removeWidget(findWidget(name))) return true;
 
-            return true;
-        }
-    }
     logErrorP("Widget not found in queue: %s", name.c_str());
     return false;
 }
 
 /**
- * @brief Will search for a widget by name and return the pointer to the widget.
+ * @brief Remove all widgets from the queue and free their memory.
+ */
+void DeviceDisplay::clearWidgets()
+{
+    while (!widgetsQueue.empty())
+    {
+        removeWidget(widgetsQueue.back());
+    }
+}
+
+/**
+ * @brief Get the programming mode widget. The handle is cached, and looked up again by the name "ProgMode" if the
+ *        widget was removed, e.g. replaced by the application.
+ * @return DeviceDisplay::WidgetInfo* the programming mode widget or nullptr if there is none
+ */
+DeviceDisplay::WidgetInfo* DeviceDisplay::progModeWidgetInfo()
+{
+    WidgetInfo* widgetInfo = getWidgetInfo(progModeWidget);
+    if (widgetInfo == nullptr)
+    {
+        progModeWidget = findWidget("ProgMode");
+        widgetInfo = getWidgetInfo(progModeWidget);
+    }
+    return widgetInfo;
+}
+
+/**
+ * @brief Will search for a widget by name and return its handle. The search compares the names of all widgets,
+ *        so look up the handle once and keep it, e.g. for a widget which is checked in every loop().
  * @param name of the widget to search for
- * @return DeviceDisplay::WidgetInfo* pointer to the widget or nullptr if not found
+ * @return DeviceDisplay::WidgetHandle handle of the widget or NO_WIDGET if not found
  */
-DeviceDisplay::WidgetInfo* DeviceDisplay::getWidgetInfo(const std::string& name)
+DeviceDisplay::WidgetHandle DeviceDisplay::findWidget(const std::string& name)
 {
-    for (WidgetInfo& widgetInfo : widgetsQueue)
+    for (const WidgetInfo& widgetInfo : widgetSlots)
     {
-        if (widgetInfo.name == name)
+        if (widgetInfo.widget != nullptr && widgetInfo.name == name)
         {
-            return &widgetInfo;
+            return widgetInfo.handle;
         }
     }
-    return nullptr;
+    return NO_WIDGET;
 }
 
 // Switches to the next widget in the queue based on duration and priority
@@ -911,9 +1040,9 @@ void DeviceDisplay::LoopWidgets()
     bool statusWidgetsInProgress = false;
 
     // First loop to prioritize and manage status widgets
-    for (WidgetInfo& widget : widgetsQueue)
+    for (WidgetHandle handle : widgetsQueue)
     {
-        showWidget = &widget;
+        showWidget = getWidgetInfo(handle);
 
         // Check if widget is a status widget with `InternalEnabled`
         if (showWidget->isActionSet(WidgetAction::StatusFlag) &&
@@ -936,7 +1065,7 @@ void DeviceDisplay::LoopWidgets()
             if (showWidget->isActionSet(WidgetAction::MarkedForRemove) && durationPassed)
             {
                 logDebugP("Removing status widget: %s", showWidget->name.c_str());
-                removeWidget(showWidget->name);
+                removeWidget(showWidget->handle);
                 break; // Exit after removing the widget
             }
 
@@ -956,13 +1085,15 @@ void DeviceDisplay::LoopWidgets()
 
     if (!statusWidgetsInProgress) // Only proceed if no active status widget
     {
-        showWidget = (&widgetsQueue[currentWidgetIndex]);
-        bool durationPassed = (currentTime - lastWidgetSwitchTime >= widgetsQueue[currentWidgetIndex].duration);
+        if (widgetsQueue.empty()) return; // The last widget was removed above
+        WidgetInfo* currentWidget = getWidgetInfo(widgetsQueue[currentWidgetIndex]);
+        showWidget = currentWidget;
+        bool durationPassed = (currentTime - lastWidgetSwitchTime >= currentWidget->duration);
 
         if (durationPassed)
         {
-            if ((&widgetsQueue[currentWidgetIndex])->isActionSet(WidgetAction::StatusFlag) &&
-                (&widgetsQueue[currentWidgetIndex])->isActionSet(WidgetAction::ExternalManaged))
+            if (currentWidget->isActionSet(WidgetAction::StatusFlag) &&
+                currentWidget->isActionSet(WidgetAction::ExternalManaged))
             {
                 // Skip `ExternalManaged` status widget without switching
                 currentWidgetIndex = (currentWidgetIndex + 1) % widgetsQueue.size();
@@ -971,21 +1102,20 @@ void DeviceDisplay::LoopWidgets()
             else
             {
                 // Remove widget if marked for removal
-                if ((&widgetsQueue[currentWidgetIndex])->isActionSet(WidgetAction::MarkedForRemove))
+                if (currentWidget->isActionSet(WidgetAction::MarkedForRemove))
                 {
-                    removeWidget((&widgetsQueue[currentWidgetIndex])->name);
-                    if (currentWidgetIndex >= widgetsQueue.size()) currentWidgetIndex = 0;
-                    showWidget = &widgetsQueue[currentWidgetIndex];
+                    removeWidget(currentWidget->handle); // Wraps currentWidgetIndex, if it was the last one
+                    showWidget = widgetsQueue.empty() ? nullptr : getWidgetInfo(widgetsQueue[currentWidgetIndex]);
                 }
                 else
                 {
                     // Auto-remove non-status widget
-                    if ((&widgetsQueue[currentWidgetIndex])->isActionSet(WidgetAction::AutoRemoveFlag))
+                    if (currentWidget->isActionSet(WidgetAction::AutoRemoveFlag))
                     {
-                        (&widgetsQueue[currentWidgetIndex])->addAction(WidgetAction::MarkedForRemove);
+                        currentWidget->addAction(WidgetAction::MarkedForRemove);
                     }
                     // Display the widget
-                    showWidget = &widgetsQueue[currentWidgetIndex];
+                    showWidget = currentWidget;
                     currentWidgetIndex = (currentWidgetIndex + 1) % widgetsQueue.size();
                     // logDebugP("Displayed regular widget: %s (Duration: %d ms)", showWidget->name.c_str(), showWidget->duration);
                 }
@@ -1005,7 +1135,10 @@ void DeviceDisplay::LoopWidgets()
         }
         else
         { // Now we are ready to draw the widget
+            koBindings.apply(showWidget->widget);             // Render the group object values received since the last frame
+            showWidget->widget->refreshBindings(currentTime); // Bound values are only evaluated for the widget on screen
             showWidget->widget->draw(&displayModule);
+            shownWidget = showWidget->handle;
         }
     }
 }
@@ -1036,7 +1169,6 @@ const char* _demoTestWidgets_conversationLines[] = {
 const int _demoTestWidgets_numLines = sizeof(_demoTestWidgets_conversationLines) / sizeof(_demoTestWidgets_conversationLines[0]);
 int _demoTestWidgets_currentLineIndex = 0;
 uint32_t _demoTestWidgets_lastUpdateTime = 0;
-uint32_t _demoTestWidgets_lastUpdateTime2 = 0;
 
 void DeviceDisplay::demoTestWidgetsStop()
 {
@@ -1056,7 +1188,6 @@ void DeviceDisplay::demoTestWidgetsStop()
     removeWidget("consoleWidget");
 
     logInfoP("All test widgets removed from the display queue.");
-    _demoWidgetSysInfo = false;
     _demoWidgeConsoleWidget = false;
 }
 void DeviceDisplay::demoTestWidgetsSetup()
@@ -1065,23 +1196,39 @@ void DeviceDisplay::demoTestWidgetsSetup()
     // Example: addWidget(&textWidget, 5000); // Show TextWidget for 5 seconds
 
     // Example Widget: Show the OpenKNX System Information
-    Widget* WidgetSysInfo = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);                                // Initialize the display and widgets
+    TextWidget* WidgetSysInfo = new TextWidget();                                // Initialize the display and widgets
     WidgetSysInfo->textLines[0].textSize = 2;                                                             // Set the text size for the header
     WidgetSysInfo->SetDynamicTextLines(                                                                   // Set the text lines and the information to display
         {"OpenKNX",                                                                                       // Header
          "",                                                                                              // Line 1
          String("Dev.: " + String(MAIN_OrderNumber)).c_str(),                                             // Line 2
          String("Ver.: " + String(openknx.info.humanFirmwareVersion().c_str())).c_str(),                  // Line 3
-         String("Addr.: " + String(openknx.info.humanIndividualAddress().c_str())).c_str(),               // Line 4
-         String("Free mem: " + String((float)freeMemory() / 1024) + " KiB").c_str(),                      // Line 5
-         String("    (min. " + String((float)openknx.common.freeMemoryMin() / 1024) + " KiB)").c_str()}); // Line 6
+         "",                                                                                              // Line 4
+         "",                                                                                              // Line 5
+         ""});                                                                                            // Line 6
+    // The changing values (lines 1, 4, 5 and 6) are bound to their lines. They are only refreshed while the widget is displayed
+    WidgetSysInfo->BindDynamicTextLine(1, [](char *text, size_t size) {
+        char value[16];
+        snprintf(text, size, "Uptime: %s", TextFormat::uptime(value, sizeof(value), uptime()));
+    });
+    WidgetSysInfo->BindDynamicTextLine(4, [](char *text, size_t size) {
+        snprintf(text, size, "Addr.: %s", openknx.info.humanIndividualAddress().c_str());
+    });
+    WidgetSysInfo->BindDynamicTextLine(5, [](char *text, size_t size) {
+        char value[16];
+        snprintf(text, size, "Free mem: %s KiB", TextFormat::fixed(value, sizeof(value), freeMemory(), 1024, 2));
+    });
+    WidgetSysInfo->BindDynamicTextLine(6, [](char *text, size_t size) {
+        char value[16];
+        snprintf(text, size, "    (min. %s KiB)", TextFormat::fixed(value, sizeof(value), openknx.common.freeMemoryMin(), 1024, 2));
+    });
     addWidget(WidgetSysInfo, 5000, "SysInfo", DeviceDisplay::WidgetAction::NoAction);                     // Add the widget to the display queue.
     logInfoP("Added System Information widget to the display queue.");
 
     //
     //  Example Widget: Show the Network Information
     //
-    Widget* WidgetNetInfo = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+    TextWidget* WidgetNetInfo = new TextWidget();
     {
         WidgetNetInfo->textLines[0].textSize = 1;                            // Set the text size for the header
         WidgetNetInfo->textLines[1].textSize = 1;                            // Set the text size for the Text line 1
@@ -1108,12 +1255,12 @@ void DeviceDisplay::demoTestWidgetsSetup()
 
     // Example Widget: Show the OpenKNX Logo
     // Since the OpenKNX logo is a part of the display module, it is not necessary to add it to the queue.
-    Widget* WidgetOKNXlogo = new Widget(Widget::DisplayMode::OPENKNX_LOGO);
+    Widget* WidgetOKNXlogo = new OpenKNXLogoWidget();
     addWidget(WidgetOKNXlogo, 3000, "UptimeLogo");
     logInfoP("Added OpenKNX Logo widget to the display queue.");
 
     // Example Widget: Text Widget with scrolling text
-    Widget* dynTextWidgetFull = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+    TextWidget* dynTextWidgetFull = new TextWidget();
     dynTextWidgetFull->SetDynamicTextLines(
         {
             "H: Fixed!",                       // Test Line 1
@@ -1129,7 +1276,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget to the display queue.");
 
     // Example Widget: Header at the top, centered and middle-aligned line below
-    Widget* dynTextWidget_Header_and_1_Line = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);                                  // Create a new dynamic text widget
+    TextWidget* dynTextWidget_Header_and_1_Line = new TextWidget();                                  // Create a new dynamic text widget
     dynTextWidget_Header_and_1_Line->textLines[1].textSize = 4;                                                               // Set the text size for the line below the header
     dynTextWidget_Header_and_1_Line->textLines[0].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_TOP;    // Set the alignment for the header
     dynTextWidget_Header_and_1_Line->textLines[1].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_MIDDLE; // Set the alignment for the line below the header
@@ -1139,7 +1286,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with header and 1 line to the display queue.");
 
     // Example Widget:: Header aligned to the left, Footer aligned to the right
-    Widget* dynTextWidget_LeftHeader_RightFooter = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);                                 // Create a new dynamic text widget
+    TextWidget* dynTextWidget_LeftHeader_RightFooter = new TextWidget();                                 // Create a new dynamic text widget
     dynTextWidget_LeftHeader_RightFooter->textLines[0].textSize = 1;                                                              // Header text size
     dynTextWidget_LeftHeader_RightFooter->textLines[1].textSize = 1;                                                              // Footer text size
     dynTextWidget_LeftHeader_RightFooter->textLines[0].alignPos = TextDynamicAlign::ALIGN_LEFT | TextDynamicAlign::ALIGN_TOP;     // Header alignment
@@ -1153,7 +1300,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with left header and right footer to the display queue.");
 
     // Example Widget: Three lines - Top, Center, Bottom alignment (all centered horizontally)
-    Widget* dynTextWidget_TopCenterBottom = new Widget(Widget::DisplayMode::DYNAMIC_TEXT); // Create a new dynamic text widget
+    TextWidget* dynTextWidget_TopCenterBottom = new TextWidget(); // Create a new dynamic text widget
     dynTextWidget_TopCenterBottom->textLines[0].textSize = 1;                              // Set the text size for the header. Default is 1
     dynTextWidget_TopCenterBottom->textLines[0].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_TOP;
     dynTextWidget_TopCenterBottom->textLines[1].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_MIDDLE;
@@ -1168,7 +1315,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with top, center and bottom alignment to the display queue.");
 
     // Example Widget: Multiple lines with stacked positioning (default without specific alignment flags)
-    Widget* dynTextWidget_DefaultStacking = new Widget(Widget::DisplayMode::DYNAMIC_TEXT); // Create a new dynamic text widget
+    TextWidget* dynTextWidget_DefaultStacking = new TextWidget(); // Create a new dynamic text widget
     dynTextWidget_DefaultStacking->textLines[1].textSize = 2;                              // Larger text for line 1
     dynTextWidget_DefaultStacking->textLines[2].textSize = 2;                              // Larger text for line 2
     dynTextWidget_DefaultStacking->SetDynamicTextLines(                                    // Set the text lines and the information to display
@@ -1181,7 +1328,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with default stacking to the display queue.");
 
     // Example Widget: Center and middle alignment with scrollable text
-    Widget* dynTextWidget_ScrollingCentered = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+    TextWidget* dynTextWidget_ScrollingCentered = new TextWidget();
     dynTextWidget_ScrollingCentered->textLines[0].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_TOP;
     dynTextWidget_ScrollingCentered->textLines[1].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_MIDDLE;
     dynTextWidget_ScrollingCentered->textLines[4].scrollText = false; // Do not scroll the Line 4! Default is True!
@@ -1198,7 +1345,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with centered scrolling text to the display queue.");
 
     // Example Widget: Center and middle alignment with scrollable text
-    Widget* dynTextWidget_ScrollingCentered_skipLines = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+    TextWidget* dynTextWidget_ScrollingCentered_skipLines = new TextWidget();
     dynTextWidget_ScrollingCentered_skipLines->textLines[0].alignPos = TextDynamicAlign::ALIGN_CENTER | TextDynamicAlign::ALIGN_TOP;
     dynTextWidget_ScrollingCentered_skipLines->textLines[7].alignPos = TextDynamicAlign::ALIGN_LEFT; // Align the last line to the left
     dynTextWidget_ScrollingCentered_skipLines->textLines[1].skipLineIfEmpty = true;                  // Skip empty line 1
@@ -1218,7 +1365,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with centered scrolling text and skipped empty lines to the display queue.");
 
     // Example Widget: Left-aligned text at the top and right-aligned text in the middle
-    Widget* dynTextWidget_LeftTop_RightMiddle = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+    TextWidget* dynTextWidget_LeftTop_RightMiddle = new TextWidget();
     dynTextWidget_LeftTop_RightMiddle->textLines[0].textSize = 2; // Larger text for header
     dynTextWidget_LeftTop_RightMiddle->textLines[0].alignPos = TextDynamicAlign::ALIGN_LEFT | TextDynamicAlign::ALIGN_TOP;
     dynTextWidget_LeftTop_RightMiddle->textLines[1].alignPos = TextDynamicAlign::ALIGN_RIGHT | TextDynamicAlign::ALIGN_MIDDLE;
@@ -1228,7 +1375,7 @@ void DeviceDisplay::demoTestWidgetsSetup()
     logInfoP("Added Dynamic Text widget with left top and right middle alignment to the display queue.");
 
     // Example Widget: Print all possible characters on the display
-    Widget* dynTextWidget_AllChars = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
+    TextWidget* dynTextWidget_AllChars = new TextWidget();
     dynTextWidget_AllChars->textLines[0].textSize = 1; // Set the text size for the header
     dynTextWidget_AllChars->SetDynamicTextLines(       // Set the text lines and the information to display
         {
@@ -1243,10 +1390,10 @@ void DeviceDisplay::demoTestWidgetsSetup()
 
     #ifdef QRCODE_WIDGET
     // Example Widget: Show a QR code
-    Widget* QRCodeWidget = new Widget(Widget::DisplayMode::QR_CODE);                 // Create a new QR code widget
-    QRCodeWidget->qrCodeWidget.setUrl("https://www.openknx.de");                     // Set the URL for the QR code
-    QRCodeWidget->qrCodeWidget.setAlign(QRCodeWidget::QRCodeAlignPos::ALIGN_CENTER); // Set the alignment for the QR code
-    addWidget(QRCodeWidget, 15000, "QRCode",
+    QRCodeWidget* qrCodeWidget = new QRCodeWidget();                    // Create a new QR code widget
+    qrCodeWidget->setQRCode(qrCodeOpenKNX.qrcode);                      // The QR code of https://www.openknx.de is encoded at compile time
+    qrCodeWidget->setAlign(QRCodeWidget::QRCodeAlignPos::ALIGN_CENTER); // Set the alignment for the QR code
+    addWidget(qrCodeWidget, 15000, "QRCode",
               DeviceDisplay::WidgetAction::StatusFlag |          // This is a status widget. The status flag will be displayed immediately
                   DeviceDisplay::WidgetAction::InternalEnabled | // This widget is enabled
                   DeviceDisplay::WidgetAction::AutoRemoveFlag);  // Remove this widget after display of the set duration time. Here 10sec.
@@ -1254,48 +1401,25 @@ void DeviceDisplay::demoTestWidgetsSetup()
     #endif
 
     // Example Widget: Console Widget. This widget is used to display a console simulatted output.
-    Widget* myConsoleWidget = new Widget(Widget::DisplayMode::DYNAMIC_TEXT);
-    myConsoleWidget->setAllowEmptyTextLines(true); // Allow empty text lines
-    myConsoleWidget->textLines[0].textSize = 1;    // Set the text size for the header
-    myConsoleWidget->textLines[0].alignPos = TextDynamicAlign::ALIGN_LEFT;
-    myConsoleWidget->textLines[0].textColor = SSD1306_WHITE;
-    myConsoleWidget->textLines[0].bgColor = SSD1306_BLACK;
-    addWidget(myConsoleWidget, 30000, "consoleWidget");
+    ConsoleWidget* myConsoleWidget = new ConsoleWidget(); // Console with the default history depth
+    _demoConsoleWidget = addWidget(myConsoleWidget, 30000, "consoleWidget");
     logInfoP("Added Console Widget to the display queue.");
 
-    _demoWidgetSysInfo = true;
     _demoWidgeConsoleWidget = true;
 }
 
 /**
- * @brief This function is used to update the demo test widget System Information "SysInfo" and the console widget "consoleWidget".
- *        The function will update the widgets every second.
+ * @brief This function is used to update the demo console widget "consoleWidget". The function will append a line every second.
+ *        The System Information widget "SysInfo" needs no loop, its values are bound to the lines.
  */
-void DeviceDisplay::demoSysinfoWidgetLoop()
-{
-    if (delayCheck(_demoTestWidgets_lastUpdateTime2, 1000) && isWidgetCurrentlyDisplayed("SysInfo")) // Update the display every second!
-    {
-        Widget* sysInfoWidget = getWidgetInfo("SysInfo")->widget;
-        // Do the update only if the widget is currently displayed
-
-        if (sysInfoWidget != nullptr)
-        {
-            sysInfoWidget->SetDynamicTextLine(1, String("Uptime: " + String(openknx.logger.buildUptime().c_str())).c_str());
-            sysInfoWidget->SetDynamicTextLine(4, String("Addr.: " + String(openknx.info.humanIndividualAddress().c_str())).c_str());
-            sysInfoWidget->SetDynamicTextLine(5, String("Free mem: " + String((float)freeMemory() / 1024) + " KiB").c_str());
-            sysInfoWidget->SetDynamicTextLine(6, String("    (min. " + String((float)openknx.common.freeMemoryMin() / 1024) + " KiB)").c_str());
-        }
-    }
-}
-
 void DeviceDisplay::demoConsoleWidgetLoop()
 {
-    if (delayCheck(_demoTestWidgets_lastUpdateTime, 1000) && isWidgetCurrentlyDisplayed("consoleWidget")) // Update the display every second!
+    if (delayCheck(_demoTestWidgets_lastUpdateTime, 1000) && isWidgetCurrentlyDisplayed(_demoConsoleWidget)) // Update the display every second!
     {
         if (_demoTestWidgets_currentLineIndex < _demoTestWidgets_numLines)
         {
-            DeviceDisplay::WidgetInfo* consoleWidgetInfo = getWidgetInfo("consoleWidget");
-            Widget* consoleWidget = consoleWidgetInfo->widget;
+            DeviceDisplay::WidgetInfo* consoleWidgetInfo = getWidgetInfo(_demoConsoleWidget);
+            ConsoleWidget* consoleWidget = ConsoleWidget::from(consoleWidgetInfo->widget);
             if (consoleWidget != nullptr)
             {
                 consoleWidget->appendLine(_demoTestWidgets_conversationLines[_demoTestWidgets_currentLineIndex]);
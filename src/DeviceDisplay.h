@@ -6,10 +6,18 @@
  * @date        2024-11-27
  * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
  *              Licensed under GNU GPL v3.0
+ *
+ * Widgets are kept in slots which are never moved, so a WidgetInfo* stays valid until its widget is removed.
+ * A widget is identified by a WidgetHandle: the slot index and a generation, which is incremented when the slot
+ * is reused. getWidgetInfo(handle) is a direct slot access and returns nullptr for the handle of a removed widget.
+ * Look up the handle by name once with findWidget() (or keep the one returned by addWidget()) and use it in loop().
+ * widgetsQueue holds the handles in display order.
  */
 #include "OpenKNX/Stat/RuntimeStat.h"
-#include "Widget.h"
+#include "KoBinding.h"
+#include "Widgets.h"
 #include "i2c-Display.h"
+#include <deque>
 
 #define DeviceDisplay_Display_Name "DeviceDisplay"
 #define DeviceDisplay_Display_Version "0.0.1"
@@ -54,9 +62,16 @@ class DeviceDisplay : public OpenKNX::Module
     inline const std::string name() { return DeviceDisplay_Display_Name; }       // Library name
     inline const std::string version() { return DeviceDisplay_Display_Version; } // Library version
 
-    void addWidget(Widget* widget, uint32_t duration, std::string name = "", uint8_t action = NoAction); // Add a widget to the queue
-    bool removeWidget(const std::string& name);                                                          // Remove a widget from the queue
-    inline void clearWidgets() { widgetsQueue.clear(); }                                                 // Clear all widgets from the queue
+    typedef uint16_t WidgetHandle;           // Slot index (low byte) and generation (high byte) of a widget
+    static const WidgetHandle NO_WIDGET = 0; // Handle of no widget. Never returned for an added widget
+
+    WidgetHandle addWidget(Widget* widget, uint32_t duration, std::string name = "", uint8_t action = NoAction); // Add a widget to the queue
+    bool removeWidget(WidgetHandle handle);                                                                      // Remove a widget from the queue
+    bool removeWidget(const std::string& name);                                                                  // Remove a widget from the queue by name
+    void clearWidgets();                                                                                         // Remove all widgets from the queue
+    WidgetHandle findWidget(const std::string& name);                                                            // Get the handle of a widget by name. NO_WIDGET if not found
+
+    KoBindingTable koBindings; // Group objects bound to widget content. Rendered once per frame, see processInputKo()
 
     void showHelp() override;                                               // Show help for console commands
     bool processCommand(const std::string command, bool diagnose) override; // Process console commands
@@ -68,6 +83,7 @@ class DeviceDisplay : public OpenKNX::Module
         std::string name;                    // Optional name for the widget
         uint8_t action = NoAction;           // Action flags for the widget
         uint32_t startDisplayTime = 0;
+        WidgetHandle handle = NO_WIDGET;     // Handle of the widget. Kept in a free slot to increment the generation on reuse
 
         inline void setDuration(uint32_t duration_ms) { duration = duration_ms; }  // Set the duration of the widget
         inline uint32_t getDuration() { return duration; }                         // Get the duration of the widget
@@ -85,33 +101,42 @@ class DeviceDisplay : public OpenKNX::Module
     };
     i2cDisplay displayModule; // The hardware display instance
 
-    inline bool isWidgetCurrentlyDisplayed(const std::string& name)
-    {
-        // Returns true if the widget is currently displayed on display
-        return !widgetsQueue.empty() && widgetsQueue[currentWidgetIndex].name == name;
-    }
+    // Returns true if the widget is currently displayed on display
+    inline bool isWidgetCurrentlyDisplayed(WidgetHandle handle) { return handle != NO_WIDGET && handle == shownWidget; }
+    inline bool isWidgetCurrentlyDisplayed(const std::string& name) { return isWidgetCurrentlyDisplayed(findWidget(name)); }
 
-    std::vector<WidgetInfo> widgetsQueue; // Queue of widgets to display
-    uint32_t lastWidgetSwitchTime = 0;    // Last time the widget was switched
-    size_t currentWidgetIndex = 0;        // Current widget index in the queue
+    std::vector<WidgetHandle> widgetsQueue; // Queue of widgets to display, in display order
+    uint32_t lastWidgetSwitchTime = 0;      // Last time the widget was switched
+    size_t currentWidgetIndex = 0;          // Current widget index in the queue
+    WidgetHandle shownWidget = NO_WIDGET;   // Widget drawn in the last LoopWidgets()
 
     bool progModeActive = false; // Tracks Programming Mode status
 
-    Widget widget; // Widget instance
-
     void initializeWidgets(); // Initialize widgets with default settings or add widgets to queue
     void LoopWidgets();       // Switches widgets based on timing
 
-    WidgetInfo* getWidgetInfo(const std::string& name); // Get widget info by name
+    // Get widget info by handle. nullptr if the widget was removed
+    inline WidgetInfo* getWidgetInfo(WidgetHandle handle)
+    {
+        const size_t slot = handle & 0xFF;
+        return (handle != NO_WIDGET && slot < widgetSlots.size() && widgetSlots[slot].handle == handle && widgetSlots[slot].widget != nullptr) ? &widgetSlots[slot] : nullptr;
+    }
+    inline WidgetInfo* getWidgetInfo(const std::string& name) { return getWidgetInfo(findWidget(name)); } // Get widget info by name
+
+  private:
+    std::deque<WidgetInfo> widgetSlots;      // Stable storage of the widgets. Free slots (widget == nullptr) are reused
+    WidgetHandle progModeWidget = NO_WIDGET; // The programming mode widget, checked in every loop()
+    WidgetInfo* progModeWidgetInfo();        // The programming mode widget. Looked up by name again, if it was replaced
+
+  public:
 #ifdef DEMO_WIDGET_CMD_TESTS
     // Example console conversation lines
     void demoTestWidgetsSetup();      // Demo test widgets setup
     void demoTestWidgetsStop();       // Demo test widgets remove
 
-    // Loop fpr the demo test widgets, to update their content. System info and console widget!
-    bool _demoWidgetSysInfo = false; // Flag to enable the demo widget commands
-    bool _demoWidgeConsoleWidget = false;
-    void demoSysinfoWidgetLoop(); // Demo test widgets loop
+    // Loop fpr the demo console widget, to update its content. The system info widget uses bound lines!
+    bool _demoWidgeConsoleWidget = false;        // Flag to enable the demo widget commands
+    WidgetHandle _demoConsoleWidget = NO_WIDGET; // The demo console widget, updated in demoConsoleWidgetLoop()
     void demoConsoleWidgetLoop();     // Demo test widgets
 #endif
 };
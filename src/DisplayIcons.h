@@ -75,6 +75,34 @@ static const unsigned char PROGMEM logo_OpenKNX[] = {
 
 };
 
+// logo_OpenKNX as run-length compressed asset (see RleBitmap.h). 399 instead of 896 bytes
+static const unsigned char PROGMEM logo_OpenKNX_rle[] = {
+    0x88, 0x7E, 0xBF, 0x9F, 0x70, 0x1C, 0xBF, 0x9A, 0x40, 0x01, 0xBF, 0x99, 0x60, 0x30, 0x10, 0xBF,
+    0x99, 0x73, 0x42, 0xBF, 0x95, 0x46, 0x86, 0x42, 0xBF, 0x93, 0x40, 0x88, 0x40, 0xBF, 0x96, 0x40,
+    0x01, 0x08, 0x39, 0x7C, 0x89, 0xC6, 0x87, 0x73, 0x7C, 0x03, 0xCF, 0xA1, 0x60, 0x30, 0x06, 0x01,
+    0x40, 0x04, 0x02, 0x9A, 0x44, 0x8B, 0x44, 0x8D, 0x40, 0x40, 0x02, 0x86, 0x40, 0x08, 0xB8, 0x78,
+    0x20, 0x07, 0x60, 0x89, 0x78, 0x20, 0xB4, 0x42, 0x86, 0x44, 0x08, 0x40, 0x08, 0x20, 0xB7, 0x40,
+    0x40, 0x04, 0x02, 0x89, 0x40, 0xBF, 0x87, 0x48, 0x8B, 0x40, 0xBF, 0x96, 0xC8, 0xBF, 0x8D, 0x40,
+    0xBF, 0xBF, 0xAE, 0x44, 0x8B, 0x44, 0x96, 0xCC, 0xBF, 0x89, 0x40, 0xBF, 0x89, 0x40, 0x01, 0x08,
+    0x9F, 0x70, 0xA9, 0x42, 0x88, 0x40, 0x8D, 0x44, 0x44, 0x88, 0x40, 0xA7, 0x42, 0x86, 0x42, 0x87,
+    0x40, 0x92, 0x44, 0xAC, 0x43, 0x4E, 0x08, 0x87, 0x46, 0x10, 0x46, 0x18, 0xB1, 0x40, 0x60, 0x20,
+    0x87, 0x70, 0x40, 0x43, 0x41, 0xB1, 0x40, 0x01, 0x93, 0x40, 0x10, 0x01, 0xB3, 0x70, 0x1C, 0x8A,
+    0x61, 0x40, 0x06, 0x03, 0x01, 0x70, 0x0F, 0x07, 0xCE, 0x8C, 0x7E, 0x90, 0x78, 0x8A, 0x7E, 0xA1,
+    0x70, 0xBF, 0xBF, 0xBF, 0x9A, 0xD9, 0x01, 0xFA, 0x0F, 0xC6, 0xBF, 0xBF, 0xBF, 0x93, 0xC9, 0x07,
+    0xC8, 0x3D, 0xFF, 0xC8, 0xBF, 0xBF, 0xBF, 0x9D, 0x78, 0xBF, 0x9B, 0xD1, 0x01, 0x7C, 0x88, 0xC6,
+    0x07, 0x70, 0x86, 0x7C, 0x1F, 0x60, 0x03, 0x7C, 0xA9, 0x40, 0x8A, 0x40, 0x93, 0x40, 0xB4, 0x40,
+    0x20, 0x98, 0x40, 0x88, 0x40, 0x40, 0xA3, 0x40, 0x20, 0x86, 0x40, 0x8C, 0x40, 0x40, 0x40, 0x40,
+    0xA3, 0x40, 0x20, 0xBF, 0x9A, 0x40, 0x20, 0x89, 0x40, 0x8C, 0x40, 0x42, 0x02, 0xA7, 0x40, 0x20,
+    0x8B, 0x40, 0x8C, 0x40, 0x40, 0xAC, 0x40, 0x20, 0xAA, 0x40, 0x40, 0xA1, 0x40, 0x20, 0x8E, 0x40,
+    0x8C, 0x40, 0x60, 0x20, 0xAA, 0x40, 0xA3, 0x40, 0xAF, 0x40, 0x40, 0x90, 0x40, 0x99, 0x40, 0xA1,
+    0x40, 0x99, 0x40, 0x8C, 0x40, 0x04, 0xA5, 0x40, 0x94, 0x40, 0x93, 0x40, 0xB4, 0x40, 0x92, 0x40,
+    0x95, 0x40, 0xAC, 0x40, 0x8B, 0x40, 0x40, 0xBF, 0xB5, 0x40, 0x10, 0xA8, 0x40, 0x40, 0x8B, 0x40,
+    0x40, 0x89, 0x40, 0x04, 0xA8, 0x40, 0x10, 0x8D, 0x40, 0x40, 0xBE, 0x48, 0xAB, 0x40, 0x01, 0x88,
+    0xD1, 0x8C, 0x42, 0x02, 0x90, 0x40, 0xBF, 0x08, 0x89, 0x40, 0x9E, 0x40, 0x60, 0x20, 0xA7, 0x40,
+    0x92, 0x40, 0x8A, 0x40, 0x08, 0x08, 0xB0, 0x40, 0x8B, 0x40, 0x90, 0x40, 0xB0, 0x40, 0x20, 0x9B,
+    0x40, 0x42, 0x02, 0xAB, 0x40, 0x92, 0x40, 0x86, 0x40, 0x8D, 0x40, 0xAD, 0x40, 0x8B, 0x40, 0x8C,
+    0x40, 0x40, 0xAD, 0x40, 0x20, 0x97, 0x40, 0x40, 0x10, 0x10, 0xBF, 0x08, 0x01, 0x97, 0xC0};
+
 #define LOGO_WIDTH_ICON_SMALL_OKNX 33
 #define LOGO_HEIGHT_ICON_SMALL_OKNX 33
 const unsigned char logoICON_SMALL_OKNX[] PROGMEM = { // Icon streched to fit into the display. Looks propotional on the display
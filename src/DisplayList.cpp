@@ -0,0 +1,278 @@
+#include "DisplayList.h"
+#include "FastText.h"
+
+#define DISPLAY_LIST_MAX_DIRTY 8 // Maximum number of separate dirty areas. More areas are merged into one
+
+/**
+ * @brief Calculate the FNV-1a hash of a memory block.
+ *
+ * @param data pointer to the data
+ * @param len size of the data in bytes
+ * @param seed start value. Use the result of a previous call to hash multiple blocks
+ * @return uint32_t the hash value
+ */
+uint32_t DisplayList::hash(const void *data, size_t len, uint32_t seed)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t h = seed;
+    for (size_t i = 0; i < len; i++)
+    {
+        h ^= bytes[i];
+        h *= 16777619UL; // FNV prime
+    }
+    return h;
+}
+
+/**
+ * @brief Start a new frame. The primitives of the last frame are kept for the comparison in commit().
+ */
+void DisplayList::begin()
+{
+    _items.clear();
+}
+
+/**
+ * @brief Add a text run with the built-in font. The bounds are the full character cells (6x8 * textSize).
+ *
+ * @param x start position of the text
+ * @param y start position of the text
+ * @param text the text. Not null-terminated, see len. Must be valid until commit()
+ * @param len number of characters
+ * @param color text color
+ * @param bg background color. Same as color for transparent text
+ * @param textSize the text size
+ */
+void DisplayList::addText(int16_t x, int16_t y, const char *text, uint16_t len, uint16_t color, uint16_t bg, uint8_t textSize)
+{
+    addText(x, y, text, len, color, bg, textSize, hash(text, len));
+}
+
+/**
+ * @brief Add a text run with a known hash of its content, e.g. kept by the caller since the text was set. The text
+ *        is not hashed again, so an unchanged text costs no time per frame.
+ *
+ * @param contentHash hash which changes whenever the visible characters change, e.g. hash() of the text
+ * @see addText()
+ */
+void DisplayList::addText(int16_t x, int16_t y, const char *text, uint16_t len, uint16_t color, uint16_t bg, uint8_t textSize, uint32_t contentHash)
+{
+    Primitive item = {Type::TEXT, textSize, color, bg, len, {x, y, (int16_t)(len * FastText::GLYPH_WIDTH * textSize), (int16_t)(FastText::GLYPH_HEIGHT * textSize)}, {0, 0, 0, 0}, text, contentHash};
+    add(item);
+}
+
+/**
+ * @brief Add a bitmap (see Adafruit_GFX::drawBitmap()). Only the set pixels are drawn. The bitmap is compared by
+ *        its address, so its content must be constant.
+ *
+ * @param x position of the bitmap
+ * @param y position of the bitmap
+ * @param bitmap the bitmap (PROGMEM)
+ * @param w width of the bitmap
+ * @param h height of the bitmap
+ * @param color color of the set pixels
+ */
+void DisplayList::addBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color)
+{
+    Primitive item = {Type::BITMAP, 0, color, 0, 0, {x, y, w, h}, {0, 0, 0, 0}, bitmap, HASH_SEED};
+    item.hash = hash(&bitmap, sizeof(bitmap));
+    add(item);
+}
+
+/**
+ * @brief Add a rectangle outline.
+ */
+void DisplayList::addRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    Primitive item = {Type::RECT, 0, color, 0, 0, {x, y, w, h}, {0, 0, 0, 0}, nullptr, HASH_SEED};
+    add(item);
+}
+
+/**
+ * @brief Add a filled rectangle.
+ */
+void DisplayList::addFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    Primitive item = {Type::FILL_RECT, 0, color, 0, 0, {x, y, w, h}, {0, 0, 0, 0}, nullptr, HASH_SEED};
+    add(item);
+}
+
+/**
+ * @brief Add a line from (x0, y0) to (x1, y1).
+ */
+void DisplayList::addLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+    Primitive item = {Type::LINE, 0, color, 0, 0, {MIN(x0, x1), MIN(y0, y1), (int16_t)(abs(x1 - x0) + 1), (int16_t)(abs(y1 - y0) + 1)}, {x0, y0, x1, y1}, nullptr, HASH_SEED};
+    add(item);
+}
+
+/**
+ * @brief Add the parameters to the content hash and append the primitive to the current frame.
+ *
+ * @param item the primitive. The hash must be HASH_SEED or already contain the content (text, bitmap)
+ */
+void DisplayList::add(Primitive &item)
+{
+    item.hash = hash(&item.type, sizeof(item.type), item.hash);
+    item.hash = hash(&item.textSize, sizeof(item.textSize), item.hash);
+    item.hash = hash(&item.color, sizeof(item.color), item.hash);
+    item.hash = hash(&item.bg, sizeof(item.bg), item.hash);
+    item.hash = hash(item.line, sizeof(item.line), item.hash);
+    _items.push_back(item);
+}
+
+/**
+ * @brief Add an area to the dirty areas. If there are too many areas, all areas are merged into one.
+ *
+ * @param rect the area
+ */
+void DisplayList::addDirty(const Rect &rect)
+{
+    if (rect.empty()) return;
+
+    if (_dirty.size() < DISPLAY_LIST_MAX_DIRTY)
+    {
+        _dirty.push_back(rect);
+        return;
+    }
+
+    int16_t x0 = rect.x, y0 = rect.y, x1 = rect.x + rect.w, y1 = rect.y + rect.h;
+    for (const Rect &r : _dirty)
+    {
+        x0 = MIN(x0, r.x);
+        y0 = MIN(y0, r.y);
+        x1 = MAX(x1, r.x + r.w);
+        y1 = MAX(y1, r.y + r.h);
+    }
+    _dirty.clear();
+    _dirty.push_back({x0, y0, (int16_t)(x1 - x0), (int16_t)(y1 - y0)});
+}
+
+/**
+ * @brief Check if an area overlaps any dirty area.
+ *
+ * @param rect the area
+ * @return true if the area overlaps a dirty area
+ */
+bool DisplayList::isDirty(const Rect &rect) const
+{
+    for (const Rect &r : _dirty)
+    {
+        if (r.intersects(rect)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Rasterise a primitive into the framebuffer.
+ *
+ * @param gfx pointer to the display object
+ * @param item the primitive
+ */
+void DisplayList::draw(Adafruit_SSD1306 *gfx, const Primitive &item)
+{
+    switch (item.type)
+    {
+        case Type::TEXT:
+        {
+            const char *text = (const char *)item.data;
+#ifndef SUPPORT_UMALAUTS
+            if (FastText::drawText(gfx, item.bounds.x, item.bounds.y, text, item.len, item.color, item.bg, item.textSize)) break;
+#endif
+            gfx->setCursor(item.bounds.x, item.bounds.y);
+            gfx->setTextSize(item.textSize);
+            gfx->setTextColor(item.color, item.bg);
+            for (uint16_t i = 0; i < item.len; i++)
+            {
+#ifdef SUPPORT_UMALAUTS
+                gfx->write(convertCharToCP437(static_cast<uint8_t>(text[i])));
+#else
+                gfx->write(text[i]);
+#endif
+            }
+            break;
+        }
+        case Type::BITMAP:
+            gfx->drawBitmap(item.bounds.x, item.bounds.y, (const uint8_t *)item.data, item.bounds.w, item.bounds.h, item.color);
+            break;
+        case Type::RECT:
+            gfx->drawRect(item.bounds.x, item.bounds.y, item.bounds.w, item.bounds.h, item.color);
+            break;
+        case Type::FILL_RECT:
+            gfx->fillRect(item.bounds.x, item.bounds.y, item.bounds.w, item.bounds.h, item.color);
+            break;
+        case Type::LINE:
+            gfx->drawLine(item.line[0], item.line[1], item.line[2], item.line[3], item.color);
+            break;
+    }
+}
+
+/**
+ * @brief Compare the current frame with the previous frame and draw the changes. The dirty areas are cleared
+ *        with the background color and marked at the display with i2cDisplay::markDirty(). Call
+ *        i2cDisplay::displayDirty() afterwards to send them.
+ *
+ * @param display pointer to the i2cDisplay object
+ * @return uint8_t number of primitives drawn
+ */
+uint8_t DisplayList::commit(i2cDisplay *display)
+{
+    Adafruit_SSD1306 *gfx = display->display;
+    _dirty.clear();
+    _redraw.assign(_items.size(), false);
+
+    if (_invalid) // Everything has to be drawn
+    {
+        addDirty({0, 0, gfx->width(), gfx->height()});
+        _invalid = false;
+    }
+
+    // 1. Changed, added and removed primitives
+    for (size_t i = 0; i < MAX(_items.size(), _prev.size()); i++)
+    {
+        const bool hasNew = i < _items.size();
+        const bool hasOld = i < _prev.size();
+        if (hasNew && hasOld && _items[i].hash == _prev[i].hash && _items[i].bounds == _prev[i].bounds) continue; // Unchanged
+
+        if (hasOld) addDirty(_prev[i].bounds);
+        if (hasNew)
+        {
+            addDirty(_items[i].bounds);
+            _redraw[i] = true;
+        }
+    }
+
+    // 2. Unchanged primitives overlapping a dirty area are drawn again, which makes their area dirty as well
+    bool expanded = true;
+    while (expanded)
+    {
+        expanded = false;
+        for (size_t i = 0; i < _items.size(); i++)
+        {
+            if (!_redraw[i] && isDirty(_items[i].bounds))
+            {
+                _redraw[i] = true;
+                addDirty(_items[i].bounds);
+                expanded = true;
+            }
+        }
+    }
+
+    // 3. Clear the dirty areas and draw the affected primitives in their order
+    for (const Rect &r : _dirty)
+    {
+        gfx->fillRect(r.x, r.y, r.w, r.h, _background);
+        display->markDirty(r.x, r.y, r.w, r.h);
+    }
+
+    uint8_t drawn = 0;
+    for (size_t i = 0; i < _items.size(); i++)
+    {
+        if (!_redraw[i]) continue;
+        draw(gfx, _items[i]);
+        drawn++;
+    }
+
+    _prev.swap(_items);
+    _items.clear();
+    return drawn;
+}
@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file        DisplayList.h
+ * @brief       Retained display list of a widget with diffing to find the changed areas of the display
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Instead of drawing into the framebuffer directly, a widget describes its content for every frame as a list of
+ * primitives (text runs, bitmaps, rectangles, lines). Each primitive has its bounds and a hash of its content.
+ * commit() compares the new list with the list of the previous frame (by position in the list):
+ *   - Changed, added and removed primitives make their old and new bounds dirty.
+ *   - Unchanged primitives which overlap a dirty area are drawn again, and their bounds become dirty as well,
+ *     until no more primitives are affected.
+ *   - Only the dirty areas are cleared and only the affected primitives are rasterised.
+ * The dirty areas are passed to i2cDisplay::markDirty(), so i2cDisplay::displayDirty() only sends these areas.
+ *
+ * Texts are not copied. The text of a primitive must stay valid until commit() was called.
+ */
+#include "i2c-Display.h"
+#include <vector>
+
+class DisplayList
+{
+  public:
+    struct Rect
+    {
+        int16_t x, y; // Top left corner
+        int16_t w, h; // Size. Empty if w or h <= 0
+
+        inline bool empty() const { return w <= 0 || h <= 0; }
+        inline bool intersects(const Rect &r) const { return !empty() && !r.empty() && x < r.x + r.w && r.x < x + w && y < r.y + r.h && r.y < y + h; }
+        inline bool operator==(const Rect &r) const { return x == r.x && y == r.y && w == r.w && h == r.h; }
+    };
+
+    static const uint32_t HASH_SEED = 2166136261UL; // FNV-1a offset basis
+
+    // FNV-1a hash of a memory block. Chain calls by passing the previous result as seed
+    static uint32_t hash(const void *data, size_t len, uint32_t seed = HASH_SEED);
+
+    void begin();                                                                                                        // Start a new frame
+    void addText(int16_t x, int16_t y, const char *text, uint16_t len, uint16_t color, uint16_t bg, uint8_t textSize = 1); // Add a text run (built-in font)
+    void addText(int16_t x, int16_t y, const char *text, uint16_t len, uint16_t color, uint16_t bg, uint8_t textSize, uint32_t contentHash); // Same, with a precomputed hash of the text
+    void addBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);                    // Add a bitmap (PROGMEM, constant)
+    void addRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);                                             // Add a rectangle outline
+    void addFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);                                         // Add a filled rectangle
+    void addLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);                                         // Add a line
+    uint8_t commit(i2cDisplay *display);                                                                                  // Draw the changes. Returns the number of redrawn primitives
+
+    inline void invalidate() { _invalid = true; }                   // Redraw everything with the next commit(). E.g. if another widget was drawn
+    inline void setBackground(uint16_t color) { _background = color; } // Color to clear the dirty areas with. Default is black
+
+  private:
+    enum class Type : uint8_t
+    {
+        TEXT,
+        BITMAP,
+        RECT,
+        FILL_RECT,
+        LINE
+    };
+
+    struct Primitive
+    {
+        Type type;             // Type of the primitive
+        uint8_t textSize;      // Text size (TEXT only)
+        uint16_t color;        // Foreground color
+        uint16_t bg;           // Background color (TEXT only)
+        uint16_t len;          // Length of the text (TEXT only)
+        Rect bounds;           // Bounds of all pixels the primitive can change
+        int16_t line[4];       // Start and end point x0, y0, x1, y1 (LINE only)
+        const void *data;      // Text or bitmap. Only valid during the frame!
+        uint32_t hash;         // Hash of the content and all parameters
+    };
+
+    void add(Primitive &item);                                   // Hash and append a primitive
+    void draw(Adafruit_SSD1306 *gfx, const Primitive &item);     // Rasterise a primitive
+    void addDirty(const Rect &rect);                             // Add an area to the dirty areas
+    bool isDirty(const Rect &rect) const;                        // Check if an area overlaps the dirty areas
+
+    std::vector<Primitive> _items;  // Primitives of the current frame
+    std::vector<Primitive> _prev;   // Primitives of the previous frame
+    std::vector<Rect> _dirty;       // Dirty areas of the current commit()
+    std::vector<bool> _redraw;      // Primitives of the current frame to draw
+    uint16_t _background = SSD1306_BLACK;
+    bool _invalid = true;           // Redraw everything with the next commit()
+};
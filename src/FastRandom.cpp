@@ -0,0 +1,13 @@
+#include "FastRandom.h"
+
+FastRandom displayRandom;
+
+/**
+ * @brief Seed the generator. Call it once at startup, the animations only call next() and the helpers.
+ *
+ * @param seed the new state. 0 is replaced by DEFAULT_SEED, xorshift would only return 0 otherwise
+ */
+void FastRandom::seed(uint32_t seed)
+{
+    _state = (seed != 0) ? seed : DEFAULT_SEED;
+}
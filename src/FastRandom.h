@@ -0,0 +1,42 @@
+#pragma once
+/**
+ * @file        FastRandom.h
+ * @brief       Fast pseudo random numbers for the animations
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * random() of the Arduino core is a library call with a 32-bit division for every bounded value. The animations
+ * only need cheap and evenly spread numbers, so one module-wide xorshift32 generator (displayRandom) is used.
+ * It is seeded once by DeviceDisplay::setup(). Without seeding it starts with a fixed state, so the sequence
+ * (and the cost per frame) of an animation is reproducible, e.g. for benchmarks.
+ *
+ * Bounded values are taken from the upper 16 bits by a multiplication instead of a modulo, so the bound must
+ * not exceed 65536.
+ */
+#include <Arduino.h>
+
+class FastRandom
+{
+  public:
+    static const uint32_t DEFAULT_SEED = 2463534242UL; // Start state if seed() is never called
+
+    void seed(uint32_t seed);
+
+    inline uint32_t next() // Next 32-bit random number (xorshift32)
+    {
+        _state ^= _state << 13;
+        _state ^= _state >> 17;
+        _state ^= _state << 5;
+        return _state;
+    }
+    inline uint16_t below(uint32_t bound) { return ((next() >> 16) * bound) >> 16; }           // 0..bound - 1
+    inline int16_t range(int16_t min, int16_t max) { return min + (int16_t)below(max - min); } // min..max - 1, like random(min, max)
+    inline bool coin() { return next() & 0x80000000UL; }                                       // True or false
+
+  private:
+    uint32_t _state = DEFAULT_SEED; // Current state. Never 0
+};
+
+extern FastRandom displayRandom;
@@ -0,0 +1,213 @@
+#include "FastText.h"
+// Built-in 5x7 font of Adafruit_GFX. The array is static and not reachable from outside Adafruit_GFX.cpp, so this
+// is a second copy in flash (1275 bytes). It is read directly, as a glyph column is exactly one page byte
+#include <glcdfont.c>
+
+/**
+ * @brief Get the glyph of a character from the built-in font.
+ *
+ * @param c the character
+ * @param cp437 true if the CP437 character encoding is used. See Adafruit_GFX::cp437()
+ * @return const uint8_t* pointer to the 5 column bytes of the glyph (PROGMEM)
+ */
+const uint8_t *FastText::glyph(uint8_t c, bool cp437)
+{
+    if (!cp437 && c >= 176) c++; // Same as Adafruit_GFX::drawChar() for the "classic" font
+    return &font[c * 5];
+}
+
+/**
+ * @brief Scale a glyph column vertically. Every bit of the column is repeated textSize times, using a
+ *        lookup table for each nibble.
+ *
+ * @param bits the glyph column (bit 0 = top row)
+ * @param textSize the text size (1..MAX_TEXT_SIZE)
+ * @return uint32_t the scaled column with 8 * textSize bits
+ */
+uint32_t FastText::expandColumn(uint8_t bits, uint8_t textSize)
+{
+    static const uint8_t expand2[16] = {0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+                                        0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF};
+    static const uint16_t expand3[16] = {0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF,
+                                         0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF};
+    static const uint16_t expand4[16] = {0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+                                         0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF};
+
+    switch (textSize)
+    {
+        case 2: return expand2[bits & 0x0F] | ((uint32_t)expand2[bits >> 4] << 8);
+        case 3: return expand3[bits & 0x0F] | ((uint32_t)expand3[bits >> 4] << 12);
+        case 4: return expand4[bits & 0x0F] | ((uint32_t)expand4[bits >> 4] << 16);
+        default: return bits;
+    }
+}
+
+/**
+ * @brief Write one (scaled and shifted) column into the pages of the framebuffer. Only the bits set in the
+ *        mask are changed, the first byte of bits and mask belongs to the page at dst.
+ *
+ * @param dst pointer to the column in the first page
+ * @param pitch distance between two pages in bytes (display width)
+ * @param bits the column pixels
+ * @param mask the pixels of the text cell
+ * @param color text color: SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE
+ * @param bg background color. Same as color for transparent text
+ */
+void FastText::writeColumn(uint8_t *dst, int16_t pitch, uint64_t bits, uint64_t mask, uint16_t color, uint16_t bg)
+{
+    for (; mask != 0; mask >>= 8, bits >>= 8, dst += pitch)
+    {
+        const uint8_t m = mask & 0xFF;
+        const uint8_t b = bits & m;
+        if (bg != color) // Opaque: the whole cell is written
+            *dst = (*dst & ~m) | ((color == SSD1306_WHITE) ? b : (b ^ m));
+        else if (color == SSD1306_WHITE)
+            *dst |= b;
+        else if (color == SSD1306_BLACK)
+            *dst &= ~b;
+        else
+            *dst ^= b;
+    }
+}
+
+/**
+ * @brief Draw a text with the built-in font directly into the framebuffer. The fast path is used, if the
+ *        text size is 1..MAX_TEXT_SIZE and the text fits completely into the display. Otherwise nothing is
+ *        drawn and false is returned, so the caller can use Adafruit_GFX.
+ *        The result is the same as Adafruit_GFX::write() for each character.
+ *
+ * @param gfx pointer to the display object
+ * @param x start position of the text
+ * @param y start position of the text. Page aligned positions (multiple of 8) with text size 1 are fastest
+ * @param text the text to draw. Not null-terminated, see len
+ * @param len number of characters to draw
+ * @param color text color: SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE
+ * @param bg background color. Same as color for transparent text
+ * @param textSize the text size
+ * @param cp437 true if the CP437 character encoding is used
+ * @return true if the text was drawn
+ */
+bool FastText::drawText(Adafruit_SSD1306 *gfx, int16_t x, int16_t y, const char *text, uint16_t len, uint16_t color, uint16_t bg, uint8_t textSize, bool cp437)
+{
+    if (textSize < 1 || textSize > MAX_TEXT_SIZE || gfx->getRotation() != 0 ||
+        y < 0 || y + GLYPH_HEIGHT * textSize > gfx->height() ||
+        x < 0 || x + len * GLYPH_WIDTH * textSize > gfx->width())
+    {
+        return false; // Not supported or clipped
+    }
+
+    for (uint16_t i = 0; i < len; i++)
+    {
+        if (text[i] == '\n' || text[i] == '\r') return false; // Control characters are handled by Adafruit_GFX::write()
+    }
+
+    if (bg != color)
+    {
+        if (!((color == SSD1306_WHITE && bg == SSD1306_BLACK) || (color == SSD1306_BLACK && bg == SSD1306_WHITE))) return false;
+    }
+    else if (color > SSD1306_INVERSE)
+    {
+        return false;
+    }
+
+    uint8_t *dst = gfx->getBuffer() + (y / 8) * gfx->width() + x;
+
+    if (textSize != 1 || (y & 7) != 0) // Scaled or not page aligned: shift the columns into the pages
+    {
+        const uint8_t shift = y & 7;
+        const uint64_t mask = (((uint64_t)1 << (GLYPH_HEIGHT * textSize)) - 1) << shift;
+        const int16_t pitch = gfx->width();
+
+        for (uint16_t i = 0; i < len; i++)
+        {
+            const uint8_t *columns = glyph(text[i], cp437);
+            for (uint8_t col = 0; col < 5; col++)
+            {
+                const uint64_t bits = (uint64_t)expandColumn(pgm_read_byte(&columns[col]), textSize) << shift;
+                for (uint8_t rep = 0; rep < textSize; rep++)
+                {
+                    writeColumn(dst++, pitch, bits, mask, color, bg);
+                }
+            }
+            for (uint8_t rep = 0; rep < textSize; rep++, dst++) // Spacing column
+            {
+                if (bg != color) writeColumn(dst, pitch, 0, mask, color, bg);
+            }
+        }
+        return true;
+    }
+
+    if (bg != color) // Opaque text: the whole 6x8 cell is written
+    {
+        const uint8_t invert = (color == SSD1306_BLACK) ? 0xFF : 0x00;
+        for (uint16_t i = 0; i < len; i++)
+        {
+            const uint8_t *columns = glyph(text[i], cp437);
+            for (uint8_t col = 0; col < 5; col++)
+            {
+                *dst++ = pgm_read_byte(&columns[col]) ^ invert;
+            }
+            *dst++ = invert; // Spacing column
+        }
+    }
+    else // Transparent text: only the glyph pixels are changed
+    {
+        for (uint16_t i = 0; i < len; i++)
+        {
+            const uint8_t *columns = glyph(text[i], cp437);
+            for (uint8_t col = 0; col < 5; col++, dst++)
+            {
+                const uint8_t bits = pgm_read_byte(&columns[col]);
+                switch (color)
+                {
+                    case SSD1306_WHITE: *dst |= bits; break;
+                    case SSD1306_BLACK: *dst &= ~bits; break;
+                    case SSD1306_INVERSE: *dst ^= bits; break;
+                }
+            }
+            dst++; // Spacing column is not touched
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Print a null-terminated text at the given position. Uses the fast path if possible, otherwise
+ *        Adafruit_GFX with the same parameters. The text cursor of Adafruit_GFX is only updated in the
+ *        fallback case.
+ *
+ * @param gfx pointer to the display object
+ * @param x start position of the text
+ * @param y start position of the text
+ * @param text the text to print
+ * @param color text color
+ * @param bg background color. Same as color for transparent text
+ * @param textSize the text size
+ */
+void FastText::print(Adafruit_SSD1306 *gfx, int16_t x, int16_t y, const char *text, uint16_t color, uint16_t bg, uint8_t textSize)
+{
+    if (drawText(gfx, x, y, text, strlen(text), color, bg, textSize)) return;
+
+    gfx->setTextSize(textSize);
+    gfx->setTextColor(color, bg);
+    gfx->setCursor(x, y);
+    gfx->print(text);
+}
+
+/**
+ * @brief Get the column bytes of a character, e.g. to keep often used glyphs in RAM. Each byte is one column of
+ *        the 6x8 cell in the SSD1306 page layout, white on black.
+ *
+ * @param c the character
+ * @param columns receives GLYPH_WIDTH bytes. The last one is the (empty) spacing column
+ * @param cp437 true if the CP437 character encoding is used
+ */
+void FastText::glyphColumns(uint8_t c, uint8_t columns[GLYPH_WIDTH], bool cp437)
+{
+    const uint8_t *src = glyph(c, cp437);
+    for (uint8_t col = 0; col < 5; col++)
+    {
+        columns[col] = pgm_read_byte(&src[col]);
+    }
+    columns[5] = 0x00; // Spacing column
+}
@@ -0,0 +1,46 @@
+#pragma once
+/**
+ * @file        FastText.h
+ * @brief       Fast text rendering with the built-in 5x7 font straight into the SSD1306 framebuffer
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Adafruit_GFX::write() draws every glyph pixel by pixel. In the SSD1306 page layout one byte holds 8 pixels of
+ * a column, which is exactly one glyph column of the built-in font. If the text starts at a Y position which is a
+ * multiple of 8, every glyph column can be copied with a single byte write.
+ * Colors are applied per byte: white on black is a copy, black on white is the copy XOR 0xFF and transparent
+ * text is OR'ed, AND'ed or XOR'ed into the page.
+ *
+ * Scaled text (text size 2..4) expands every glyph column with lookup tables (each bit doubled, tripled or
+ * quadrupled) to 16..32 bits and writes them as whole bytes into the pages. Texts at any Y position are
+ * shifted into the pages and written with a mask for the first and last page.
+ *
+ * The glyphs are read from an own copy of the built-in font (glcdfont.c), which adds 1275 bytes of flash.
+ */
+#include <Adafruit_SSD1306.h>
+
+class FastText
+{
+  public:
+    static const uint8_t GLYPH_WIDTH = 6;  // Width of a glyph incl. spacing for text size 1
+    static const uint8_t GLYPH_HEIGHT = 8; // Height of a glyph for text size 1
+
+    static const uint8_t MAX_TEXT_SIZE = 4; // Largest text size supported by the fast path
+
+    // Draw the text with the built-in font. Returns false if the fast path is not possible, then use Adafruit_GFX instead
+    static bool drawText(Adafruit_SSD1306 *gfx, int16_t x, int16_t y, const char *text, uint16_t len,
+                         uint16_t color, uint16_t bg, uint8_t textSize = 1, bool cp437 = true);
+
+    // Print the text with the fast path, or with Adafruit_GFX if the fast path is not possible
+    static void print(Adafruit_SSD1306 *gfx, int16_t x, int16_t y, const char *text, uint16_t color, uint16_t bg, uint8_t textSize = 1);
+
+    // Get the page bytes of a character for text size 1: 5 glyph columns and the spacing column (bit 0 = top row)
+    static void glyphColumns(uint8_t c, uint8_t columns[GLYPH_WIDTH], bool cp437 = true);
+
+  private:
+    static const uint8_t *glyph(uint8_t c, bool cp437);                                         // Get the 5 column bytes of the glyph
+    static uint32_t expandColumn(uint8_t bits, uint8_t textSize);                               // Scale a glyph column vertically
+    static void writeColumn(uint8_t *dst, int16_t pitch, uint64_t bits, uint64_t mask, uint16_t color, uint16_t bg); // Write a column into the pages
+};
@@ -0,0 +1,75 @@
+#include "FixedMath.h"
+
+const int16_t FixedMath::SIN_TABLE[ANGLE_QUARTER + 1] = {
+        0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,  2411,  2611,  2811,  3012,
+     3212,  3412,  3612,  3812,  4011,  4211,  4410,  4609,  4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,
+     6393,  6590,  6787,  6983,  7180,  7376,  7571,  7767,  7962,  8157,  8351,  8546,  8740,  8933,  9127,  9319,
+     9512,  9704,  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605, 11793, 11980, 12167, 12354,
+    12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828, 14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+    15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001, 20160, 20318, 20475, 20632,
+    20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856, 22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028,
+    23170, 23312, 23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+    27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803,
+    28899, 28993, 29086, 29178, 29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298,
+    31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737, 31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099,
+    32138, 32177, 32214, 32251, 32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753, 32758, 32762, 32766, 32767,
+    32767
+};
+
+const uint16_t FixedMath::RECIPROCAL_TABLE[256] = {
+    65535, 32768, 21845, 16384, 13107, 10923,  9362,  8192,  7282,  6554,  5958,  5461,  5041,  4681,  4369,  4096,
+     3855,  3641,  3449,  3277,  3121,  2979,  2849,  2731,  2621,  2521,  2427,  2341,  2260,  2185,  2114,  2048,
+     1986,  1928,  1872,  1820,  1771,  1725,  1680,  1638,  1598,  1560,  1524,  1489,  1456,  1425,  1394,  1365,
+     1337,  1311,  1285,  1260,  1237,  1214,  1192,  1170,  1150,  1130,  1111,  1092,  1074,  1057,  1040,  1024,
+     1008,   993,   978,   964,   950,   936,   923,   910,   898,   886,   874,   862,   851,   840,   830,   819,
+      809,   799,   790,   780,   771,   762,   753,   745,   736,   728,   720,   712,   705,   697,   690,   683,
+      676,   669,   662,   655,   649,   643,   636,   630,   624,   618,   612,   607,   601,   596,   590,   585,
+      580,   575,   570,   565,   560,   555,   551,   546,   542,   537,   533,   529,   524,   520,   516,   512,
+      508,   504,   500,   496,   493,   489,   485,   482,   478,   475,   471,   468,   465,   462,   458,   455,
+      452,   449,   446,   443,   440,   437,   434,   431,   428,   426,   423,   420,   417,   415,   412,   410,
+      407,   405,   402,   400,   397,   395,   392,   390,   388,   386,   383,   381,   379,   377,   374,   372,
+      370,   368,   366,   364,   362,   360,   358,   356,   354,   352,   350,   349,   347,   345,   343,   341,
+      340,   338,   336,   334,   333,   331,   329,   328,   326,   324,   323,   321,   320,   318,   317,   315,
+      314,   312,   311,   309,   308,   306,   305,   303,   302,   301,   299,   298,   297,   295,   294,   293,
+      291,   290,   289,   287,   286,   285,   284,   282,   281,   280,   279,   278,   277,   275,   274,   273,
+      272,   271,   270,   269,   267,   266,   265,   264,   263,   262,   261,   260,   259,   258,   257,   256
+};
+
+/**
+ * @brief Sine of an angle from the quarter-wave table.
+ *
+ * @param angle the angle in ANGLE_FULL units per full circle. Wraps around
+ * @return int16_t the sine in Q15 (-32767..32767)
+ */
+int16_t FixedMath::sin(uint16_t angle)
+{
+    angle %= ANGLE_FULL;
+    const uint16_t quadrant = angle / ANGLE_QUARTER;
+    const uint16_t index = angle % ANGLE_QUARTER;
+
+    switch (quadrant)
+    {
+        case 0: return SIN_TABLE[index];
+        case 1: return SIN_TABLE[ANGLE_QUARTER - index];
+        case 2: return -SIN_TABLE[index];
+        default: return -SIN_TABLE[ANGLE_QUARTER - index];
+    }
+}
+
+/**
+ * @brief Reciprocal for projections. E.g. x * distance / z becomes (x * distance * reciprocal(z)) >> 16.
+ *
+ * @param d the divisor
+ * @return uint32_t 1 / d in Q16 (65536 for d = 1). 0 for d = 0
+ */
+uint32_t FixedMath::reciprocal(uint16_t d)
+{
+    if (d == 0) return 0;
+    if (d == 1) return ONE_Q16;
+    if (d <= 256) return RECIPROCAL_TABLE[d - 1];
+    return (ONE_Q16 + d / 2) / d;
+}
@@ -0,0 +1,35 @@
+#pragma once
+/**
+ * @file        FixedMath.h
+ * @brief       Fixed-point trigonometry and projection for the animations
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * The RP2040 has no FPU, so every float sin(), cos() and division of the animations runs in software.
+ * FixedMath replaces them with tables and integer arithmetic:
+ *   - Angles are given in ANGLE_FULL (1024) units per full circle. Larger values wrap around.
+ *   - sin() and cos() return Q15 values (-32768..32767 for -1.0..1.0) from a quarter-wave table.
+ *   - mulQ15() multiplies a value with a Q15 factor, e.g. radius * cos(angle).
+ *   - reciprocal() returns 1/d in Q16 from a table for projections (x * distance / depth).
+ */
+#include <Arduino.h>
+
+class FixedMath
+{
+  public:
+    static const uint16_t ANGLE_FULL = 1024;              // Angle units per full circle
+    static const uint16_t ANGLE_QUARTER = ANGLE_FULL / 4; // 90 degrees
+    static const int32_t ONE_Q15 = 32768;                 // 1.0 in Q15
+    static const int32_t ONE_Q16 = 65536;                 // 1.0 in Q16
+
+    static int16_t sin(uint16_t angle);                                                      // Sine in Q15
+    static inline int16_t cos(uint16_t angle) { return sin(angle + ANGLE_QUARTER); }         // Cosine in Q15
+    static inline int32_t mulQ15(int32_t value, int16_t q15) { return (value * q15) >> 15; } // value * q15 / 32768
+    static uint32_t reciprocal(uint16_t d);                                                  // 1 / d in Q16. 0 for d = 0
+
+  private:
+    static const int16_t SIN_TABLE[ANGLE_QUARTER + 1]; // Quarter wave, Q15
+    static const uint16_t RECIPROCAL_TABLE[256];       // 1 / d in Q16 for d = 1..256 (d = 1 saturated)
+};
@@ -0,0 +1,117 @@
+#include "KoBinding.h"
+
+/**
+ * @brief Bind a group object to a text line. The line shows the value formatted with TextFormat::fixed().
+ *
+ * @param asap number of the group object
+ * @param dpt datapoint type of the group object
+ * @param widget the text widget. Call unbind() before the widget is deleted
+ * @param lineIndex index of the line
+ * @param format printf format with one %s for the value. Not copied, so it must stay valid
+ * @param decimals number of decimals (0..MAX_DECIMALS)
+ * @example bindLine(KO_TEMPERATURE, DPT_Value_Temp, widget, 2, "Temp.: %s C", 1); // "Temp.: 21.5 C"
+ */
+void KoBindingTable::bindLine(uint16_t asap, const Dpt &dpt, TextWidget *widget, uint8_t lineIndex, const char *format, uint8_t decimals)
+{
+    if (widget == nullptr || format == nullptr) return;
+
+    decimals = MIN(decimals, MAX_DECIMALS);
+    bind(asap, dpt, widget, [widget, lineIndex, format, decimals](int32_t value) {
+        static const uint16_t divisors[MAX_DECIMALS + 1] = {1, 10, 100, 1000};
+        char text[16];
+        widget->SetDynamicTextLinef(lineIndex, format, TextFormat::fixed(text, sizeof(text), value, divisors[decimals], decimals));
+    }, decimals);
+}
+
+/**
+ * @brief Bind a group object to a sink, which renders the value into the widget. A group object can be bound
+ *        multiple times, e.g. to a line and to an icon.
+ *
+ * @param asap number of the group object
+ * @param dpt datapoint type of the group object
+ * @param widget the widget showing the value. Its bindings are only rendered while it is shown. nullptr if the
+ *        sink should run with every frame
+ * @param sink renders the fixed-point value
+ * @param decimals number of decimals of the fixed-point value (0..MAX_DECIMALS)
+ */
+void KoBindingTable::bind(uint16_t asap, const Dpt &dpt, Widget *widget, Sink sink, uint8_t decimals)
+{
+    if (!sink) return;
+    _bindings.push_back({dpt, widget, sink, 0, asap, (uint8_t)MIN(decimals, MAX_DECIMALS), false, false});
+}
+
+/**
+ * @brief Remove all bindings of a widget. Must be called before the widget is deleted.
+ *
+ * @param widget the widget
+ */
+void KoBindingTable::unbind(Widget *widget)
+{
+    for (auto it = _bindings.begin(); it != _bindings.end();)
+    {
+        if (it->widget == widget)
+        {
+            if (it->dirty) _pending--;
+            it = _bindings.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+/**
+ * @brief Store the value of a received group object in the slots of its bindings. Nothing is formatted or drawn
+ *        here, an unchanged value does not even set the dirty flag.
+ *
+ * @param ko the group object
+ * @return true if the group object is bound
+ */
+bool KoBindingTable::update(GroupObject &ko)
+{
+    bool bound = false;
+    const uint16_t asap = ko.asap();
+    for (Binding &binding : _bindings)
+    {
+        if (binding.asap != asap) continue;
+        bound = true;
+
+        double scaled = (double)ko.value(binding.dpt);
+        for (uint8_t i = 0; i < binding.decimals; i++)
+        {
+            scaled *= 10;
+        }
+        const int32_t value = (int32_t)(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+
+        if (binding.valid && binding.value == value) continue; // Same value, nothing to render
+        binding.value = value;
+        binding.valid = true;
+        if (!binding.dirty)
+        {
+            binding.dirty = true;
+            _pending++;
+        }
+    }
+    return bound;
+}
+
+/**
+ * @brief Render the dirty values. Called once per frame right before the shown widget is drawn, so any number
+ *        of telegrams since the last frame results in one redraw with the latest values.
+ *
+ * @param shown the widget which is drawn now
+ */
+void KoBindingTable::apply(Widget *shown)
+{
+    if (_pending == 0) return;
+
+    for (Binding &binding : _bindings)
+    {
+        if (!binding.dirty || (binding.widget != nullptr && binding.widget != shown)) continue; // Hidden widgets stay dirty
+
+        binding.dirty = false;
+        _pending--;
+        binding.sink(binding.value);
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+/**
+ * @file        KoBinding.h
+ * @brief       Group objects bound to widget content, rendered at most once per frame
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * A received telegram only stores the value of the group object in the slot of its binding and sets the dirty
+ * flag. Formatting and drawing happen in DeviceDisplay::LoopWidgets() right before the widget is drawn, so a burst
+ * of telegrams (e.g. 50 status telegrams of a scene recall) results in a single redraw with the latest values.
+ * Values of hidden widgets stay dirty until the widget is shown.
+ *
+ * The values are stored as fixed-point numbers with 0..3 decimals, e.g. 21.5 °C with 1 decimal is 215:
+ *
+ *   display.koBindings.bindLine(KO_TEMPERATURE, DPT_Value_Temp, tempWidget, 2, "Temp.: %s C", 1);
+ *   display.koBindings.bind(KO_WINDOW, DPT_Switch, tempWidget, [](int32_t open) { ... }); // E.g. select an icon
+ */
+#include "TextWidget.h"
+#include <functional>
+#include <vector>
+
+class KoBindingTable
+{
+  public:
+    static const uint8_t MAX_DECIMALS = 3; // Largest number of decimals of a value slot
+
+    typedef std::function<void(int32_t value)> Sink; // Renders the fixed-point value into the widget, e.g. an icon or a gauge
+
+    // Show the value in a text line. The format needs one %s for the value and must stay valid (e.g. a literal)
+    void bindLine(uint16_t asap, const Dpt &dpt, TextWidget *widget, uint8_t lineIndex, const char *format, uint8_t decimals = 0);
+    void bind(uint16_t asap, const Dpt &dpt, Widget *widget, Sink sink, uint8_t decimals = 0); // Render the value with a sink. widget may be nullptr
+    void unbind(Widget *widget);                                                                // Remove all bindings of the widget, e.g. before it is deleted
+    inline void clear() { _bindings.clear(); _pending = 0; }                                    // Remove all bindings
+
+    bool update(GroupObject &ko); // Store the value of a received group object. Returns true if the group object is bound
+    void apply(Widget *shown);    // Render the dirty values of the shown widget and of the bindings without a widget
+    inline uint16_t pending() const { return _pending; }     // Number of dirty values
+    inline size_t size() const { return _bindings.size(); } // Number of bindings
+
+  private:
+    struct Binding
+    {
+        Dpt dpt;          // Datapoint type to read the value with
+        Widget *widget;   // Widget showing the value. nullptr: rendered with every frame
+        Sink sink;        // Renders the value
+        int32_t value;    // Value slot in fixed-point
+        uint16_t asap;    // Number of the group object
+        uint8_t decimals; // Decimals of the fixed-point value
+        bool valid;       // The slot holds a received value
+        bool dirty;       // The value has changed since it was rendered
+    };
+
+    std::vector<Binding> _bindings; // All bindings
+    uint16_t _pending = 0;          // Number of dirty bindings. 0: apply() returns immediately
+};
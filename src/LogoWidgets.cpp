@@ -0,0 +1,151 @@
+#include "LogoWidgets.h"
+#include "TextFormat.h"
+
+/**
+ * @brief Construct a new OpenKNXLogoWidget object. The drawing is split into steps, which are started
+ *        whenever the uptime changes.
+ */
+OpenKNXLogoWidget::OpenKNXLogoWidget()
+    : Widget(DisplayMode::OPENKNX_LOGO)
+{
+    _renderJob.add([](i2cDisplay *display) {
+        display->display->clearDisplay(); // Clear the display for fresh rendering
+        return true;
+    });
+    _renderJob.add([this](i2cDisplay *display) {
+        display->display->cp437(true); // Use CP437 character encoding
+        FastText::print(display->display, 0, 0 * FastText::GLYPH_HEIGHT, _uptimeLine, WHITE, WHITE);
+        FastText::print(display->display, 0, 1 * FastText::GLYPH_HEIGHT, "Dev.: " MAIN_OrderNumber, WHITE, WHITE);
+        FastText::print(display->display, 0, 2 * FastText::GLYPH_HEIGHT, _addressLine, WHITE, WHITE);
+        return true;
+    });
+    _renderJob.add([](i2cDisplay *display) {
+        display->display->drawBitmap(
+            (display->GetDisplayWidth() - LOGO_WIDTH_ICON_SMALL_OKNX) / 2,
+            (display->GetDisplayHeight() - LOGO_HEIGHT_ICON_SMALL_OKNX + 20 /*SHIFT_TO_BOTTOM*/) / 2,
+            logoICON_SMALL_OKNX, LOGO_WIDTH_ICON_SMALL_OKNX,
+            LOGO_HEIGHT_ICON_SMALL_OKNX, 1);
+        return true;
+    });
+    _renderJob.add([](i2cDisplay *display) {
+        display->displayBuff(); // Update the display with the rendered content
+        return true;
+    });
+}
+
+/**
+ * @brief DIsplay the OpenKNX logo on the screen. The logo is displayed in the
+ * center of the screen. The
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void OpenKNXLogoWidget::drawWidget(i2cDisplay *display)
+{
+    // Only the seconds counter is compared, the texts are formatted when the shown uptime changes
+    const uint32_t secs = uptime();
+    if (_shownUptime != secs)
+    {
+        _shownUptime = secs;
+        char text[20];
+        snprintf(_uptimeLine, sizeof(_uptimeLine), "Uptime: %s", TextFormat::uptime(text, sizeof(text), secs));
+        snprintf(_addressLine, sizeof(_addressLine), "Addr.: %s", openknx.info.humanIndividualAddress().c_str());
+        _renderJob.restart(); // restart drawing as uptime has changed
+    }
+    _renderJob.run(display, _renderBudgetUs);
+}
+
+/**
+ * @brief Construct a new BootLogoWidget object. The logo is drawn once, split into steps, as decoding the
+ *        bitmap is slow.
+ */
+BootLogoWidget::BootLogoWidget()
+    : Widget(DisplayMode::BOOT_LOGO)
+{
+    _renderJob.add([this](i2cDisplay *display) {
+        display->display->clearDisplay();
+        _bootLogoDecoder.begin({logo_OpenKNX_rle, sizeof(logo_OpenKNX_rle), logo_OpenKNX_WIDTH, logo_OpenKNX_HEIGHT},
+                               display->display->getBuffer(), display->GetDisplayWidth(), display->GetDisplayHeight(),
+                               (display->GetDisplayWidth() - logo_OpenKNX_WIDTH) / 2,
+                               (display->GetDisplayHeight() - logo_OpenKNX_HEIGHT) / 2);
+        return true;
+    });
+    _renderJob.add([this](i2cDisplay *display) {
+        // Decode the compressed logo straight into the display buffer, slice by slice
+        return _bootLogoDecoder.decodeRows(BOOT_LOGO_ROWS_PER_STEP);
+    });
+    _renderJob.add([](i2cDisplay *display) {
+        display->displayBuff();
+        return true;
+    });
+    _renderJob.restart(); // Draw once
+}
+
+/**
+ * @brief Shows the OpenKNX logo on the display.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void BootLogoWidget::drawWidget(i2cDisplay *display)
+{
+    _renderJob.run(display, _renderBudgetUs);
+}
+
+/**
+ * @brief Construct a new ProgModeWidget object. The drawing is split into steps, which are started on every
+ *        change of the blink state.
+ */
+ProgModeWidget::ProgModeWidget()
+    : Widget(DisplayMode::PROG_MODE)
+{
+    _renderJob.add([](i2cDisplay *display) {
+        display->display->clearDisplay(); // Clear the display
+        display->display->setTextColor(SSD1306_WHITE);
+        return true;
+    });
+    _renderJob.add([](i2cDisplay *display) {
+        // Set the header: "OpenKNX" (always visible, not blinking)
+        display->display->setTextSize(1);                // Set font size to normal for the header
+        display->display->setCursor(0, 0);               // Position the cursor at the top
+        display->display->print("   www.OpenKNX.de   "); // Print the header
+        return true;
+    });
+    _renderJob.add([this](i2cDisplay *display) {
+        // Show the "Prog Mode active" message if the blink state is true
+        _showProgrammingMode_showProgMode
+            ? FastText::print(display->display, 0, 20, " ProgMode!", SSD1306_BLACK, SSD1306_WHITE, 2) // Print "Prog Mode" inverted
+            : FastText::print(display->display, 0, 20, " ProgMode!", SSD1306_WHITE, SSD1306_WHITE, 2);
+        return true;
+    });
+    _renderJob.add([](i2cDisplay *display) {
+        display->display->setTextColor(SSD1306_WHITE);
+        display->display->setTextSize(1);                                         // Set font size to large for the message
+        display->display->setCursor(0, 45);                                       // Position the cursor for the message
+        display->display->println(" Ready to use ETS to  program the Device!  "); // Print "Prog Mode"
+        return true;
+    });
+    _renderJob.add([](i2cDisplay *display) {
+        // Update the display with the new content
+        display->displayBuff();
+        return true;
+    });
+}
+
+/**
+ * @brief Will show the "Prog Mode active" message on the display with a
+ * blinking effect. The message will blink every 500ms.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void ProgModeWidget::drawWidget(i2cDisplay *display)
+{
+    ulong currentTime = millis();
+
+    // Check if it's time to toggle the blink state
+    if (currentTime - _showProgrammingMode_last_Blink >= PROG_MODE_BLINK_DELAY)
+    {
+        _showProgrammingMode_last_Blink = currentTime;                          // Update the last blink time
+        _showProgrammingMode_showProgMode = !_showProgrammingMode_showProgMode; // Toggle the blink state (show/hide text)
+        _renderJob.restart();
+    }
+    _renderJob.run(display, _renderBudgetUs);
+}
@@ -0,0 +1,59 @@
+#pragma once
+/**
+ * @file        LogoWidgets.h
+ * @brief       Widgets for the boot logo, the OpenKNX logo and the programming mode
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ */
+#include "Widget.h"
+#include "RenderJob.h"
+#include "RleBitmap.h"
+
+// Default widget settings
+#define PROG_MODE_BLINK_DELAY 500 // Blink delay for "Prog Mode active" text
+#define BOOT_LOGO_TIMEOUT 5000    // Timeout for showing the boot logo
+#define BOOT_LOGO_ROWS_PER_STEP 8 // Rows of the boot logo decoded per render step
+
+class OpenKNXLogoWidget : public Widget
+{
+  public:
+    OpenKNXLogoWidget(); // Constructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the OpenKNX logo with uptime and address
+
+  private:
+    RenderJob _renderJob;               // Time-sliced drawing
+    uint32_t _shownUptime = UINT32_MAX; // Uptime in seconds of the rendered text. UINT32_MAX if nothing is rendered yet
+    char _uptimeLine[32] = {0};         // "Uptime: ..." formatted when the uptime changes
+    char _addressLine[32] = {0};        // "Addr.: ..." formatted when the uptime changes
+};
+
+class BootLogoWidget : public Widget
+{
+  public:
+    BootLogoWidget(); // Constructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the boot logo once
+
+  private:
+    RenderJob _renderJob;        // Time-sliced drawing
+    RleDecoder _bootLogoDecoder; // Streaming decoder of the compressed boot logo
+};
+
+class ProgModeWidget : public Widget
+{
+  public:
+    ProgModeWidget(); // Constructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the blinking programming mode message
+
+  private:
+    RenderJob _renderJob;                          // Time-sliced drawing
+    ulong _showProgrammingMode_last_Blink = 0;     // Last time the blink state was updated
+    bool _showProgrammingMode_showProgMode = true; // Toggle between showing/hiding "Prog Mode active"
+};
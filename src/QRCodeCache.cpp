@@ -0,0 +1,105 @@
+#include "QRCodeCache.h"
+#include <cstring>
+
+QRCodeCache::Entry QRCodeCache::_entries[QRCODE_CACHE_SIZE];
+uint32_t QRCodeCache::_useCounter = 0;
+uint32_t QRCodeCache::_hits = 0;
+uint32_t QRCodeCache::_misses = 0;
+
+/**
+ * @brief Get the encoded QR code of a text. If the text was encoded before with the same settings, the modules are
+ *        taken from the cache. Otherwise the text is encoded in one go into the least recently used entry.
+ *
+ * @param text the text of the QR code
+ * @param ecc the error correction level
+ * @param minVersion minimum QR code version
+ * @param maxVersion maximum QR code version. Must not be larger than QRCODE_VERSION_MAX
+ * @return const uint8_t* the QR code for qrcodegen_getSize()/qrcodegen_getModule(). Only valid until the next get().
+ *         nullptr if the text cannot be encoded
+ */
+const uint8_t *QRCodeCache::get(const std::string &text, qrcodegen_Ecc ecc, int minVersion, int maxVersion)
+{
+    const uint8_t *qrcode = find(text, ecc, minVersion, maxVersion);
+    if (qrcode != nullptr || text.empty() || maxVersion > QRCODE_VERSION_MAX) return qrcode;
+
+    const QRCodeEncoder::Bitmap bitmap = QRCodeEncoder::encode(text.c_str(), ecc, minVersion, maxVersion);
+    if (!bitmap.valid()) return nullptr;
+    return store(text, ecc, minVersion, maxVersion, bitmap.qrcode);
+}
+
+/**
+ * @brief Get the encoded QR code of a text from the cache. Nothing is encoded on a miss, e.g. the caller encodes
+ *        the text step by step and stores it afterwards.
+ *
+ * @param text the text of the QR code
+ * @param ecc the error correction level
+ * @param minVersion minimum QR code version
+ * @param maxVersion maximum QR code version
+ * @return const uint8_t* the QR code, only valid until the next get() or store(). nullptr if the text is not cached
+ */
+const uint8_t *QRCodeCache::find(const std::string &text, qrcodegen_Ecc ecc, int minVersion, int maxVersion)
+{
+    if (text.empty()) return nullptr;
+
+    for (Entry &entry : _entries)
+    {
+        if (entry.ecc == ecc && entry.minVersion == minVersion && entry.maxVersion == maxVersion && entry.text == text)
+        {
+            entry.lastUse = ++_useCounter;
+            _hits++;
+            return entry.qrcode;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Store an encoded QR code in the least recently used entry.
+ *
+ * @param text the text of the QR code
+ * @param ecc the error correction level used for the encoding
+ * @param minVersion minimum QR code version used for the encoding
+ * @param maxVersion maximum QR code version used for the encoding
+ * @param qrcode the encoded QR code (qrcodegen format, BUFFER_LEN bytes)
+ * @return const uint8_t* the cached copy of the QR code. Only valid until the next get() or store()
+ */
+const uint8_t *QRCodeCache::store(const std::string &text, qrcodegen_Ecc ecc, int minVersion, int maxVersion, const uint8_t *qrcode)
+{
+    _misses++;
+    Entry *entry = victim();
+    memcpy(entry->qrcode, qrcode, BUFFER_LEN);
+    entry->text = text;
+    entry->ecc = ecc;
+    entry->minVersion = minVersion;
+    entry->maxVersion = maxVersion;
+    entry->lastUse = ++_useCounter;
+    return entry->qrcode;
+}
+
+/**
+ * @brief Find the entry to replace: an unused one or the least recently used one.
+ *
+ * @return QRCodeCache::Entry* the entry to replace
+ */
+QRCodeCache::Entry *QRCodeCache::victim()
+{
+    Entry *victim = &_entries[0];
+    for (Entry &entry : _entries)
+    {
+        if (entry.text.empty()) return &entry;
+        if (entry.lastUse < victim->lastUse) victim = &entry;
+    }
+    return victim;
+}
+
+/**
+ * @brief Remove all entries, e.g. to free the memory of the texts.
+ */
+void QRCodeCache::clear()
+{
+    for (Entry &entry : _entries)
+    {
+        entry.text.clear();
+        entry.text.shrink_to_fit();
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+/**
+ * @file        QRCodeCache.h
+ * @brief       Shared cache of encoded QR codes for all QR code widgets
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Encoding a QR code evaluates all eight masks, which is by far the most expensive part of the QR code widget.
+ * Usually the same few codes are shown again and again (setup URL, Wi-Fi join, support link), so the encoded
+ * modules (qrcodegen format) are kept in a small LRU cache keyed by text, error correction level and version
+ * range. A new widget for a known text takes the modules from the cache without encoding it again.
+ *
+ * get() encodes a missing text in one go. The QR code widget encodes step by step with QRCodeEncoder instead and
+ * uses find() and store(). The returned pointers are only valid until the next get() or store(), since the
+ * entry may be replaced.
+ */
+#include "QRCodeEncoder.h"
+#include "qrcodegen.h"
+#include <string>
+
+#ifndef QRCODE_CACHE_SIZE
+    #define QRCODE_CACHE_SIZE 4 // Number of encoded QR codes kept in the cache
+#endif
+
+class QRCodeCache
+{
+  public:
+    static constexpr size_t BUFFER_LEN = QRCodeEncoder::BUFFER_LEN; // Size of an encoded QR code
+
+    // Get the encoded QR code of the text. Encodes it on a miss. nullptr if the text does not fit into the versions
+    static const uint8_t *get(const std::string &text, qrcodegen_Ecc ecc, int minVersion, int maxVersion);
+    // Get the encoded QR code of the text without encoding it. nullptr on a miss
+    static const uint8_t *find(const std::string &text, qrcodegen_Ecc ecc, int minVersion, int maxVersion);
+    // Copy a QR code encoded by the caller into the cache, replacing the least recently used entry
+    static const uint8_t *store(const std::string &text, qrcodegen_Ecc ecc, int minVersion, int maxVersion, const uint8_t *qrcode);
+    static void clear(); // Remove all entries
+
+    static inline uint32_t hits() { return _hits; }     // Number of QR codes taken from the cache
+    static inline uint32_t misses() { return _misses; } // Number of QR codes encoded
+
+  private:
+    struct Entry
+    {
+        std::string text;                      // Encoded text. Empty: unused entry
+        uint32_t lastUse = 0;                  // Use counter at the last access. The smallest one is replaced
+        qrcodegen_Ecc ecc = qrcodegen_Ecc_LOW; // Error correction level of the encoding
+        uint8_t minVersion = 0;                // Minimum version of the encoding
+        uint8_t maxVersion = 0;                // Maximum version of the encoding
+        uint8_t qrcode[BUFFER_LEN];            // Encoded modules in the qrcodegen format
+    };
+
+    static Entry *victim(); // Unused or least recently used entry
+
+    static Entry _entries[QRCODE_CACHE_SIZE]; // Cached QR codes
+    static uint32_t _useCounter;              // Incremented with every access
+    static uint32_t _hits;                    // Statistics: QR codes taken from the cache
+    static uint32_t _misses;                  // Statistics: QR codes encoded
+};
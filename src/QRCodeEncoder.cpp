@@ -0,0 +1,5 @@
+#include "QRCodeEncoder.h"
+
+// Encoded by the compiler with the same settings as the QR code widget. Stored in flash, no encoding at runtime
+extern constexpr QRCodeEncoder::Bitmap qrCodeOpenKNX = QRCodeEncoder::encode(QRCODE_OPENKNX_URL);
+static_assert(qrCodeOpenKNX.valid(), "QRCODE_OPENKNX_URL does not fit into QRCODE_VERSION_MAX");
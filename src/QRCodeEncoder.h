@@ -0,0 +1,665 @@
+#pragma once
+/**
+ * @file        QRCodeEncoder.h
+ * @brief       constexpr QR code encoder for QR codes in flash, compatible with the qrcodegen library
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Port of the encoder of the QR-Code library (https://github.com/nayuki/QR-Code-generator) with the same segment
+ * mode selection (numeric, alphanumeric or byte), ECC boost and automatic mask, so the result is the same as from
+ * qrcodegen_encodeText(). Everything is constexpr: a QR code for a text known at build time is encoded by the
+ * compiler and stored in flash, no encoding and no encoder buffers are needed at runtime:
+ *
+ *   constexpr QRCodeEncoder::Bitmap qrDocs = QRCodeEncoder::encode("https://www.openknx.de/docs");
+ *   static_assert(qrDocs.valid(), "Text does not fit into QRCODE_VERSION_MAX");
+ *   qrCodeWidget->setQRCode(qrDocs.qrcode);
+ *
+ * The result uses the format of qrcodegen (byte 0 = size, then the modules row by row), so qrcodegen_getModule()
+ * and the QR code widget can be used with it.
+ */
+#include "qrcodegen.h"
+
+// QR code versions used by the widget. The buffers are sized for QRCODE_VERSION_MAX at compile time,
+// e.g. 106 bytes each for version 3 instead of 3918 bytes for qrcodegen_BUFFER_LEN_MAX (version 40).
+#ifndef QRCODE_VERSION_MIN
+    #define QRCODE_VERSION_MIN 3 // Minimum QR code version (Min: 1)
+#endif
+#ifndef QRCODE_VERSION_MAX
+    #define QRCODE_VERSION_MAX 3 // Maximum QR code version (Max: 40)
+#endif
+
+#define QRCODE_OPENKNX_URL "https://www.openknx.de" // Fallback of the QR code widget
+
+class QRCodeEncoder
+{
+  public:
+    static constexpr size_t BUFFER_LEN = qrcodegen_BUFFER_LEN_FOR_VERSION(QRCODE_VERSION_MAX); // Size of an encoded QR code
+    static_assert(QRCODE_VERSION_MIN >= qrcodegen_VERSION_MIN && QRCODE_VERSION_MIN <= QRCODE_VERSION_MAX && QRCODE_VERSION_MAX <= qrcodegen_VERSION_MAX, "Invalid QR code versions");
+
+    struct Bitmap // Encoded QR code in the qrcodegen format
+    {
+        uint8_t qrcode[BUFFER_LEN] = {};                              // Size and modules
+        constexpr int size() const { return qrcode[0]; }              // Size in modules. 0 if the text could not be encoded
+        constexpr bool valid() const { return qrcode[0] != 0; }       // True if the text was encoded
+        constexpr bool getModule(int x, int y) const { return QRCodeEncoder::getModule(qrcode, x, y); } // True for a dark module
+    };
+
+    // Encode the text in one go, e.g. at compile time. Same parameters and result as qrcodegen_encodeText() with the automatic mask
+    static constexpr Bitmap encode(const char *text, qrcodegen_Ecc ecc = qrcodegen_Ecc_LOW, int minVersion = QRCODE_VERSION_MIN,
+                                   int maxVersion = QRCODE_VERSION_MAX, bool boostEcl = true)
+    {
+        QRCodeEncoder encoder;
+        Bitmap bitmap;
+        if (!encoder.encodeData(text, ecc, minVersion, maxVersion, boostEcl)) return bitmap; // Does not fit. Size 0
+        encoder.drawCodewords();
+        for (uint8_t mask = 0; mask < 8; mask++)
+        {
+            encoder.evaluateMask(mask);
+        }
+        encoder.finish();
+        for (size_t i = 0; i < BUFFER_LEN; i++)
+        {
+            bitmap.qrcode[i] = encoder._qrcode[i];
+        }
+        return bitmap;
+    }
+
+    static constexpr bool getModule(const uint8_t *qrcode, int x, int y) // Same as qrcodegen_getModule() without the range check
+    {
+        const int index = y * qrcode[0] + x;
+        return ((qrcode[(index >> 3) + 1] >> (index & 7)) & 1) != 0;
+    }
+
+    // Steps of the encoding. Call them in this order, evaluateMask() for each of the 8 masks
+    constexpr bool encodeData(const char *text, qrcodegen_Ecc ecc, int minVersion, int maxVersion, bool boostEcl); // Select version and segment mode, write the data bits
+    constexpr void drawCodewords();              // Add the ECC, interleave the blocks and draw all modules without mask
+    constexpr void evaluateMask(uint8_t mask);   // Calculate the penalty of a mask and remember the best one
+    constexpr void finish();                     // Apply the best mask and draw the format bits
+    constexpr const uint8_t *qrcode() const { return _qrcode; } // The QR code. Complete after finish()
+
+  private:
+    static constexpr int PENALTY_N1 = 3;
+    static constexpr int PENALTY_N2 = 3;
+    static constexpr int PENALTY_N3 = 40;
+    static constexpr int PENALTY_N4 = 10;
+
+    // Error correction codewords per block and number of blocks for each ECC level (L, M, Q, H) and version (index 0 unused)
+    static constexpr int8_t ECC_CODEWORDS_PER_BLOCK[4][41] = {
+        {-1, 7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28, 28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+        {-1, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+        {-1, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30, 28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+        {-1, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28, 30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30}};
+    static constexpr int8_t NUM_ERROR_CORRECTION_BLOCKS[4][41] = {
+        {-1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4, 4, 4, 4, 4, 6, 6, 6, 6, 7, 8, 8, 9, 9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25},
+        {-1, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5, 5, 8, 9, 9, 10, 10, 11, 13, 14, 16, 17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49},
+        {-1, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8, 8, 10, 12, 16, 12, 17, 16, 18, 21, 20, 23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68},
+        {-1, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25, 25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81}};
+
+    static constexpr const char *ALPHANUMERIC_CHARSET = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ $%*+-./:";
+
+    enum Mode : uint8_t // Segment modes. Value = mode indicator
+    {
+        MODE_NUMERIC = 0x1,
+        MODE_ALPHANUMERIC = 0x2,
+        MODE_BYTE = 0x4
+    };
+
+    // Helpers, same as the static functions of qrcodegen.c
+    static constexpr int getNumRawDataModules(int version);
+    static constexpr int getNumDataCodewords(int version, qrcodegen_Ecc ecc);
+    static constexpr int getAlignmentPatternPositions(int version, uint8_t result[7]);
+    static constexpr int numCharCountBits(Mode mode, int version);
+    static constexpr int alphanumericIndex(char c);
+    static constexpr void appendBits(uint32_t value, int numBits, uint8_t *buffer, int &bitLen);
+    static constexpr void setModule(uint8_t *qrcode, int x, int y, bool dark);
+    static constexpr void fillRectangle(int left, int top, int width, int height, uint8_t *qrcode);
+    static constexpr void initializeFunctionModules(int version, uint8_t *qrcode);
+    static constexpr void drawLightFunctionModules(uint8_t *qrcode, int version);
+    static constexpr void drawFormatBits(qrcodegen_Ecc ecc, uint8_t mask, uint8_t *qrcode);
+    static constexpr void applyMask(const uint8_t *functionModules, uint8_t *qrcode, uint8_t mask);
+    static constexpr uint8_t reedSolomonMultiply(uint8_t x, uint8_t y);
+    static constexpr long getPenaltyScore(const uint8_t *qrcode);
+    static constexpr void finderPenaltyAddHistory(int currentRunLength, int runHistory[7], int size);
+    static constexpr int finderPenaltyCountPatterns(const int runHistory[7], int size);
+    static constexpr int finderPenaltyTerminateAndCount(bool currentRunColor, int currentRunLength, int runHistory[7], int size);
+
+    uint8_t _qrcode[BUFFER_LEN] = {}; // Data codewords, then the QR code
+    uint8_t _temp[BUFFER_LEN] = {};   // Interleaved codewords, then the function modules
+    qrcodegen_Ecc _ecc = qrcodegen_Ecc_LOW;
+    int8_t _version = 0;              // Selected version. 0: not encoded
+    uint8_t _bestMask = 0;            // Mask with the lowest penalty so far
+    long _minPenalty = 0;             // Penalty of the best mask. Only valid after the first evaluateMask()
+    bool _maskEvaluated = false;      // At least one mask was evaluated
+};
+
+extern const QRCodeEncoder::Bitmap qrCodeOpenKNX; // QR code of QRCODE_OPENKNX_URL, encoded at compile time
+
+/**
+ * @brief Select the segment mode (like qrcodegen_encodeText()), the smallest version and the (boosted) ECC level
+ *        and write the data bits incl. terminator and padding.
+ *
+ * @return true if the text fits into the versions
+ */
+constexpr bool QRCodeEncoder::encodeData(const char *text, qrcodegen_Ecc ecc, int minVersion, int maxVersion, bool boostEcl)
+{
+    _version = 0;
+    _maskEvaluated = false;
+    if (text == nullptr || minVersion < qrcodegen_VERSION_MIN || minVersion > maxVersion || maxVersion > QRCODE_VERSION_MAX) return false;
+
+    int len = 0;
+    bool numeric = true;
+    bool alphanumeric = true;
+    for (; text[len] != '\0'; len++)
+    {
+        numeric &= (text[len] >= '0' && text[len] <= '9');
+        alphanumeric &= (alphanumericIndex(text[len]) >= 0);
+    }
+    const Mode mode = (len == 0) ? MODE_BYTE : numeric ? MODE_NUMERIC : alphanumeric ? MODE_ALPHANUMERIC : MODE_BYTE;
+    const int payloadBits = (mode == MODE_NUMERIC) ? (len * 10 + 2) / 3 : (mode == MODE_ALPHANUMERIC) ? (len * 11 + 1) / 2 : len * 8;
+
+    int version = minVersion;
+    int usedBits = 0;
+    for (;; version++)
+    {
+        const int ccBits = numCharCountBits(mode, version);
+        usedBits = (len == 0) ? 0 : 4 + ccBits + payloadBits;
+        if (len < (1L << ccBits) && usedBits <= getNumDataCodewords(version, ecc) * 8) break;
+        if (version >= maxVersion) return false;
+    }
+    for (int i = (int)qrcodegen_Ecc_MEDIUM; i <= (int)qrcodegen_Ecc_HIGH; i++) // Use the highest ECC level which fits into the version
+    {
+        if (boostEcl && usedBits <= getNumDataCodewords(version, (qrcodegen_Ecc)i) * 8) ecc = (qrcodegen_Ecc)i;
+    }
+
+    for (size_t i = 0; i < BUFFER_LEN; i++)
+    {
+        _qrcode[i] = 0;
+    }
+    int bitLen = 0;
+    if (len > 0)
+    {
+        appendBits(mode, 4, _qrcode, bitLen);
+        appendBits(len, numCharCountBits(mode, version), _qrcode, bitLen);
+        uint32_t accum = 0;
+        int count = 0;
+        for (int i = 0; i < len; i++)
+        {
+            if (mode == MODE_NUMERIC) // Groups of 3 digits in 10 bits
+            {
+                accum = accum * 10 + (text[i] - '0');
+                if (++count == 3)
+                {
+                    appendBits(accum, 10, _qrcode, bitLen);
+                    accum = count = 0;
+                }
+            }
+            else if (mode == MODE_ALPHANUMERIC) // Pairs of characters in 11 bits
+            {
+                accum = accum * 45 + alphanumericIndex(text[i]);
+                if (++count == 2)
+                {
+                    appendBits(accum, 11, _qrcode, bitLen);
+                    accum = count = 0;
+                }
+            }
+            else
+            {
+                appendBits((uint8_t)text[i], 8, _qrcode, bitLen);
+            }
+        }
+        if (count > 0) appendBits(accum, (mode == MODE_NUMERIC) ? count * 3 + 1 : 6, _qrcode, bitLen); // Remaining digits or character
+    }
+
+    // Terminator, padding to a byte and pad bytes up to the capacity
+    const int capacityBits = getNumDataCodewords(version, ecc) * 8;
+    appendBits(0, (capacityBits - bitLen > 4) ? 4 : capacityBits - bitLen, _qrcode, bitLen);
+    appendBits(0, (8 - bitLen % 8) % 8, _qrcode, bitLen);
+    for (uint8_t padByte = 0xEC; bitLen < capacityBits; padByte ^= 0xEC ^ 0x11)
+    {
+        appendBits(padByte, 8, _qrcode, bitLen);
+    }
+
+    _version = version;
+    _ecc = ecc;
+    return true;
+}
+
+/**
+ * @brief Split the data into the blocks, add the Reed-Solomon ECC, interleave the codewords and draw them with the
+ *        function patterns. Afterwards _temp holds the function modules for applyMask().
+ */
+constexpr void QRCodeEncoder::drawCodewords()
+{
+    if (_version == 0) return;
+
+    // Add the ECC and interleave: _qrcode (data) -> _temp (all codewords)
+    const int numBlocks = NUM_ERROR_CORRECTION_BLOCKS[_ecc][_version];
+    const int blockEccLen = ECC_CODEWORDS_PER_BLOCK[_ecc][_version];
+    const int rawCodewords = getNumRawDataModules(_version) / 8;
+    const int dataLen = getNumDataCodewords(_version, _ecc);
+    const int numShortBlocks = numBlocks - rawCodewords % numBlocks;
+    const int shortBlockDataLen = rawCodewords / numBlocks - blockEccLen;
+
+    uint8_t divisor[30] = {}; // Generator polynomial of the Reed-Solomon code
+    divisor[blockEccLen - 1] = 1;
+    uint8_t root = 1;
+    for (int i = 0; i < blockEccLen; i++)
+    {
+        for (int j = 0; j < blockEccLen; j++)
+        {
+            divisor[j] = reedSolomonMultiply(divisor[j], root);
+            if (j + 1 < blockEccLen) divisor[j] ^= divisor[j + 1];
+        }
+        root = reedSolomonMultiply(root, 0x02);
+    }
+
+    for (int i = 0, offset = 0; i < numBlocks; i++)
+    {
+        const int datLen = shortBlockDataLen + (i < numShortBlocks ? 0 : 1);
+        uint8_t ecc[30] = {}; // Remainder of the block
+        for (int j = 0; j < datLen; j++)
+        {
+            const uint8_t factor = _qrcode[offset + j] ^ ecc[0];
+            for (int k = 0; k + 1 < blockEccLen; k++)
+            {
+                ecc[k] = ecc[k + 1] ^ reedSolomonMultiply(divisor[k], factor);
+            }
+            ecc[blockEccLen - 1] = reedSolomonMultiply(divisor[blockEccLen - 1], factor);
+        }
+        for (int j = 0, k = i; j < datLen; j++, k += numBlocks) // Copy data
+        {
+            if (j == shortBlockDataLen) k -= numShortBlocks;
+            _temp[k] = _qrcode[offset + j];
+        }
+        for (int j = 0, k = dataLen + i; j < blockEccLen; j++, k += numBlocks) // Copy ECC
+        {
+            _temp[k] = ecc[j];
+        }
+        offset += datLen;
+    }
+
+    // Draw the codewords in the zigzag scan, around the (dark) function modules
+    initializeFunctionModules(_version, _qrcode);
+    const int size = _qrcode[0];
+    for (int right = size - 1, bit = 0; right >= 1; right -= 2) // Right column of each column pair
+    {
+        if (right == 6) right = 5; // Skip the vertical timing pattern
+        for (int vert = 0; vert < size; vert++)
+        {
+            for (int j = 0; j < 2; j++)
+            {
+                const int x = right - j;
+                const int y = (((right + 1) & 2) == 0) ? size - 1 - vert : vert; // Upward or downward
+                if (!getModule(_qrcode, x, y) && bit < rawCodewords * 8)
+                {
+                    setModule(_qrcode, x, y, ((_temp[bit >> 3] >> (7 - (bit & 7))) & 1) != 0);
+                    bit++;
+                }
+            }
+        }
+    }
+    drawLightFunctionModules(_qrcode, _version);
+    initializeFunctionModules(_version, _temp);
+}
+
+/**
+ * @brief Calculate the penalty of a mask. The QR code is unchanged afterwards.
+ *
+ * @param mask the mask (0..7)
+ */
+constexpr void QRCodeEncoder::evaluateMask(uint8_t mask)
+{
+    if (_version == 0) return;
+
+    applyMask(_temp, _qrcode, mask);
+    drawFormatBits(_ecc, mask, _qrcode);
+    const long penalty = getPenaltyScore(_qrcode);
+    if (!_maskEvaluated || penalty < _minPenalty)
+    {
+        _bestMask = mask;
+        _minPenalty = penalty;
+        _maskEvaluated = true;
+    }
+    applyMask(_temp, _qrcode, mask); // Undo the mask (XOR)
+}
+
+/**
+ * @brief Apply the mask with the lowest penalty and draw the format bits.
+ */
+constexpr void QRCodeEncoder::finish()
+{
+    if (_version == 0) return;
+
+    applyMask(_temp, _qrcode, _bestMask);
+    drawFormatBits(_ecc, _bestMask, _qrcode);
+}
+
+constexpr int QRCodeEncoder::getNumRawDataModules(int version)
+{
+    int result = (16 * version + 128) * version + 64;
+    if (version >= 2)
+    {
+        const int numAlign = version / 7 + 2;
+        result -= (25 * numAlign - 10) * numAlign - 55;
+        if (version >= 7) result -= 36;
+    }
+    return result;
+}
+
+constexpr int QRCodeEncoder::getNumDataCodewords(int version, qrcodegen_Ecc ecc)
+{
+    return getNumRawDataModules(version) / 8 - ECC_CODEWORDS_PER_BLOCK[ecc][version] * NUM_ERROR_CORRECTION_BLOCKS[ecc][version];
+}
+
+constexpr int QRCodeEncoder::getAlignmentPatternPositions(int version, uint8_t result[7])
+{
+    if (version == 1) return 0;
+    const int numAlign = version / 7 + 2;
+    const int step = (version * 8 + numAlign * 3 + 5) / (numAlign * 4 - 4) * 2;
+    for (int i = numAlign - 1, pos = version * 4 + 10; i >= 1; i--, pos -= step)
+    {
+        result[i] = pos;
+    }
+    result[0] = 6;
+    return numAlign;
+}
+
+constexpr int QRCodeEncoder::numCharCountBits(Mode mode, int version)
+{
+    const int i = (version + 7) / 17;
+    switch (mode)
+    {
+        case MODE_NUMERIC: return (i == 0) ? 10 : (i == 1) ? 12 : 14;
+        case MODE_ALPHANUMERIC: return (i == 0) ? 9 : (i == 1) ? 11 : 13;
+        default: return (i == 0) ? 8 : 16;
+    }
+}
+
+constexpr int QRCodeEncoder::alphanumericIndex(char c)
+{
+    for (int i = 0; ALPHANUMERIC_CHARSET[i] != '\0'; i++)
+    {
+        if (ALPHANUMERIC_CHARSET[i] == c) return i;
+    }
+    return -1;
+}
+
+constexpr void QRCodeEncoder::appendBits(uint32_t value, int numBits, uint8_t *buffer, int &bitLen)
+{
+    for (int i = numBits - 1; i >= 0; i--, bitLen++)
+    {
+        buffer[bitLen >> 3] |= ((value >> i) & 1) << (7 - (bitLen & 7));
+    }
+}
+
+constexpr void QRCodeEncoder::setModule(uint8_t *qrcode, int x, int y, bool dark)
+{
+    const int index = y * qrcode[0] + x;
+    if (dark)
+        qrcode[(index >> 3) + 1] |= 1 << (index & 7);
+    else
+        qrcode[(index >> 3) + 1] &= (1 << (index & 7)) ^ 0xFF;
+}
+
+constexpr void QRCodeEncoder::fillRectangle(int left, int top, int width, int height, uint8_t *qrcode)
+{
+    for (int dy = 0; dy < height; dy++)
+    {
+        for (int dx = 0; dx < width; dx++)
+        {
+            setModule(qrcode, left + dx, top + dy, true);
+        }
+    }
+}
+
+// Clear the QR code and mark all function modules dark
+constexpr void QRCodeEncoder::initializeFunctionModules(int version, uint8_t *qrcode)
+{
+    const int size = version * 4 + 17;
+    for (int i = 0; i < qrcodegen_BUFFER_LEN_FOR_VERSION(version); i++)
+    {
+        qrcode[i] = 0;
+    }
+    qrcode[0] = size;
+
+    fillRectangle(6, 0, 1, size, qrcode); // Timing patterns
+    fillRectangle(0, 6, size, 1, qrcode);
+    fillRectangle(0, 0, 9, 9, qrcode); // Finder patterns and format bits
+    fillRectangle(size - 8, 0, 8, 9, qrcode);
+    fillRectangle(0, size - 8, 9, 8, qrcode);
+
+    uint8_t alignPatPos[7] = {};
+    const int numAlign = getAlignmentPatternPositions(version, alignPatPos);
+    for (int i = 0; i < numAlign; i++)
+    {
+        for (int j = 0; j < numAlign; j++)
+        {
+            if (!((i == 0 && j == 0) || (i == 0 && j == numAlign - 1) || (i == numAlign - 1 && j == 0))) // Not on the finder corners
+                fillRectangle(alignPatPos[i] - 2, alignPatPos[j] - 2, 5, 5, qrcode);
+        }
+    }
+
+    if (version >= 7) // Version blocks
+    {
+        fillRectangle(size - 11, 0, 3, 6, qrcode);
+        fillRectangle(0, size - 11, 6, 3, qrcode);
+    }
+}
+
+// Draw the light modules of the function patterns and the version blocks. The format bits are drawn later
+constexpr void QRCodeEncoder::drawLightFunctionModules(uint8_t *qrcode, int version)
+{
+    const int size = qrcode[0];
+    for (int i = 7; i < size - 7; i += 2) // Timing patterns
+    {
+        setModule(qrcode, 6, i, false);
+        setModule(qrcode, i, 6, false);
+    }
+
+    for (int dy = -4; dy <= 4; dy++) // Finder patterns incl. separators
+    {
+        for (int dx = -4; dx <= 4; dx++)
+        {
+            const int absX = dx < 0 ? -dx : dx;
+            const int absY = dy < 0 ? -dy : dy;
+            const int dist = absX > absY ? absX : absY;
+            if (dist == 2 || dist == 4)
+            {
+                if (3 + dx >= 0 && 3 + dy >= 0) setModule(qrcode, 3 + dx, 3 + dy, false);
+                if (size - 4 + dx < size && 3 + dy >= 0) setModule(qrcode, size - 4 + dx, 3 + dy, false);
+                if (3 + dx >= 0 && size - 4 + dy < size) setModule(qrcode, 3 + dx, size - 4 + dy, false);
+            }
+        }
+    }
+
+    uint8_t alignPatPos[7] = {};
+    const int numAlign = getAlignmentPatternPositions(version, alignPatPos);
+    for (int i = 0; i < numAlign; i++)
+    {
+        for (int j = 0; j < numAlign; j++)
+        {
+            if ((i == 0 && j == 0) || (i == 0 && j == numAlign - 1) || (i == numAlign - 1 && j == 0)) continue; // Finder corners
+            for (int dy = -1; dy <= 1; dy++)
+            {
+                for (int dx = -1; dx <= 1; dx++)
+                {
+                    setModule(qrcode, alignPatPos[i] + dx, alignPatPos[j] + dy, dx == 0 && dy == 0);
+                }
+            }
+        }
+    }
+
+    if (version >= 7) // Version blocks: version (6 bits) with Golay code (12 bits)
+    {
+        int rem = version;
+        for (int i = 0; i < 12; i++)
+        {
+            rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+        }
+        long bits = (long)version << 12 | rem;
+        for (int i = 0; i < 6; i++)
+        {
+            for (int j = 0; j < 3; j++, bits >>= 1)
+            {
+                setModule(qrcode, size - 11 + j, i, (bits & 1) != 0);
+                setModule(qrcode, i, size - 11 + j, (bits & 1) != 0);
+            }
+        }
+    }
+}
+
+constexpr void QRCodeEncoder::drawFormatBits(qrcodegen_Ecc ecc, uint8_t mask, uint8_t *qrcode)
+{
+    const int eccBits[4] = {1, 0, 3, 2}; // Format bits of L, M, Q, H
+    const int data = eccBits[ecc] << 3 | mask;
+    int rem = data;
+    for (int i = 0; i < 10; i++)
+    {
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    }
+    const int bits = (data << 10 | rem) ^ 0x5412;
+
+    for (int i = 0; i <= 5; i++) // First copy
+    {
+        setModule(qrcode, 8, i, (bits >> i) & 1);
+    }
+    setModule(qrcode, 8, 7, (bits >> 6) & 1);
+    setModule(qrcode, 8, 8, (bits >> 7) & 1);
+    setModule(qrcode, 7, 8, (bits >> 8) & 1);
+    for (int i = 9; i < 15; i++)
+    {
+        setModule(qrcode, 14 - i, 8, (bits >> i) & 1);
+    }
+
+    const int size = qrcode[0]; // Second copy
+    for (int i = 0; i < 8; i++)
+    {
+        setModule(qrcode, size - 1 - i, 8, (bits >> i) & 1);
+    }
+    for (int i = 8; i < 15; i++)
+    {
+        setModule(qrcode, 8, size - 15 + i, (bits >> i) & 1);
+    }
+    setModule(qrcode, 8, size - 8, true); // Always dark
+}
+
+constexpr void QRCodeEncoder::applyMask(const uint8_t *functionModules, uint8_t *qrcode, uint8_t mask)
+{
+    const int size = qrcode[0];
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            if (getModule(functionModules, x, y)) continue;
+            bool invert = false;
+            switch (mask)
+            {
+                case 0: invert = (x + y) % 2 == 0; break;
+                case 1: invert = y % 2 == 0; break;
+                case 2: invert = x % 3 == 0; break;
+                case 3: invert = (x + y) % 3 == 0; break;
+                case 4: invert = (x / 3 + y / 2) % 2 == 0; break;
+                case 5: invert = x * y % 2 + x * y % 3 == 0; break;
+                case 6: invert = (x * y % 2 + x * y % 3) % 2 == 0; break;
+                default: invert = ((x + y) % 2 + x * y % 3) % 2 == 0; break;
+            }
+            if (invert) setModule(qrcode, x, y, !getModule(qrcode, x, y));
+        }
+    }
+}
+
+constexpr uint8_t QRCodeEncoder::reedSolomonMultiply(uint8_t x, uint8_t y)
+{
+    uint8_t z = 0;
+    for (int i = 7; i >= 0; i--) // Russian peasant multiplication in GF(2^8/0x11D)
+    {
+        z = (z << 1) ^ ((z >> 7) * 0x11D);
+        z ^= ((y >> i) & 1) * x;
+    }
+    return z;
+}
+
+constexpr long QRCodeEncoder::getPenaltyScore(const uint8_t *qrcode)
+{
+    const int size = qrcode[0];
+    long result = 0;
+
+    for (int pass = 0; pass < 2; pass++) // Runs of the same color and finder-like patterns. Rows, then columns
+    {
+        for (int a = 0; a < size; a++)
+        {
+            bool runColor = false;
+            int runLength = 0;
+            int runHistory[7] = {};
+            for (int b = 0; b < size; b++)
+            {
+                const bool dark = (pass == 0) ? getModule(qrcode, b, a) : getModule(qrcode, a, b);
+                if (dark == runColor)
+                {
+                    runLength++;
+                    if (runLength == 5)
+                        result += PENALTY_N1;
+                    else if (runLength > 5)
+                        result++;
+                }
+                else
+                {
+                    finderPenaltyAddHistory(runLength, runHistory, size);
+                    if (!runColor) result += finderPenaltyCountPatterns(runHistory, size) * PENALTY_N3;
+                    runColor = dark;
+                    runLength = 1;
+                }
+            }
+            result += finderPenaltyTerminateAndCount(runColor, runLength, runHistory, size) * PENALTY_N3;
+        }
+    }
+
+    int dark = 0;
+    for (int y = 0; y < size; y++) // 2x2 blocks of the same color and the balance of dark and light modules
+    {
+        for (int x = 0; x < size; x++)
+        {
+            const bool color = getModule(qrcode, x, y);
+            if (color) dark++;
+            if (x + 1 < size && y + 1 < size && color == getModule(qrcode, x + 1, y) && color == getModule(qrcode, x, y + 1) &&
+                color == getModule(qrcode, x + 1, y + 1))
+                result += PENALTY_N2;
+        }
+    }
+    const long total = (long)size * size;
+    const long deviation = dark * 20L - total * 10L;
+    const int k = (int)(((deviation < 0 ? -deviation : deviation) + total - 1) / total) - 1; // Smallest k with (45-5k)% <= dark <= (55+5k)%
+    result += k * PENALTY_N4;
+    return result;
+}
+
+constexpr void QRCodeEncoder::finderPenaltyAddHistory(int currentRunLength, int runHistory[7], int size)
+{
+    if (runHistory[0] == 0) currentRunLength += size; // Add the light border to the initial run
+    for (int i = 6; i > 0; i--)
+    {
+        runHistory[i] = runHistory[i - 1];
+    }
+    runHistory[0] = currentRunLength;
+}
+
+constexpr int QRCodeEncoder::finderPenaltyCountPatterns(const int runHistory[7], int size)
+{
+    const int n = runHistory[1];
+    const bool core = n > 0 && runHistory[2] == n && runHistory[3] == n * 3 && runHistory[4] == n && runHistory[5] == n;
+    return (core && runHistory[0] >= n * 4 && runHistory[6] >= n ? 1 : 0) + (core && runHistory[6] >= n * 4 && runHistory[0] >= n ? 1 : 0);
+}
+
+constexpr int QRCodeEncoder::finderPenaltyTerminateAndCount(bool currentRunColor, int currentRunLength, int runHistory[7], int size)
+{
+    if (currentRunColor) // Terminate the dark run
+    {
+        finderPenaltyAddHistory(currentRunLength, runHistory, size);
+        currentRunLength = 0;
+    }
+    currentRunLength += size; // Add the light border to the final run
+    finderPenaltyAddHistory(currentRunLength, runHistory, size);
+    return finderPenaltyCountPatterns(runHistory, size);
+}
@@ -29,6 +29,8 @@
  * The QR code is generated based on the display size and the URL. The QR code is centered on the display.
  * The icon is optional and can be placed in the center of the QR code. The background color can be set to white or black.
  * The QR code is generated only once to avoid unnecessary processing.
+ * A text which is not cached is encoded step by step across loop() calls within the render budget (data encoding,
+ * ECC and module placement, one step per mask evaluation). A placeholder frame is shown until the encoding is done.
  *
  * The QR code is generated using the QR-Code library  (https://github.com/nayuki/QR-Code-generator).
  * The QR code is displayed on the I2C monochrome display.
@@ -44,19 +46,30 @@
  * - Geo Location QR Code ("geo:Latitude,Longitude")
  * - Bitcoin QR Code ("bitcoin:<address>?amount=<amount>")
  *
- * Attention: Maximum QR Code Version is set to 3! Minimum QR Code Version is set to 3!
+ * Attention: Maximum QR Code Version is set to 3! Minimum QR Code Version is set to 3! (QRCODE_VERSION_MIN/MAX)
  *            Max possible characters for the QR code is 127 characters!
  */
 
-// #include "i2c-display.h"
+#include "Widget.h"
+#include "QRCodeCache.h"
+#include "RenderJob.h"
 #include "qrcodegen.h"
 // extern "C" {
 //   #include "qrcodegen.h" // QR-Code library (https://github.com/nayuki/QR-Code-generator)
 // } // Not using here the #include <qrcodegen.hpp>
 
-class QRCodeWidget
+#ifndef QRCODE_QUIET_ZONE
+    #define QRCODE_QUIET_ZONE 1 // Modules of background around the code. Reduced, if the code would not fit with the scale of 2
+#endif
+
+class QRCodeWidget : public Widget
 {
   public:
+    static constexpr int VERSION_MIN = QRCODE_VERSION_MIN;                                  // Minimum QR code version
+    static constexpr int VERSION_MAX = QRCODE_VERSION_MAX;                                  // Maximum QR code version
+    static constexpr size_t BUFFER_LEN = QRCodeCache::BUFFER_LEN;                           // Size of an encoded QR code
+    static constexpr qrcodegen_Ecc ECC = qrcodegen_Ecc_LOW;                                 // Error correction level. Boosted, if the version allows it
+
     struct Icon // Icon struct which holds the bitmap data and size for the icon in the QR code
     {
         const uint8_t* bitmapData; // Bitmap data for the icon
@@ -82,16 +95,22 @@ class QRCodeWidget
     };
 
     // Constructor for QRCodeWidget
-    QRCodeWidget(i2cDisplay* display, const std::string& url, bool backgroundWhite)
-        : _display(display), _url(url), _backgroundWhite(backgroundWhite), _qrCodeGenerated(false) {}
+    QRCodeWidget(i2cDisplay* display = nullptr, const std::string& url = "", bool backgroundWhite = false)
+        : Widget(DisplayMode::QR_CODE), _display(display), _url(url), _backgroundWhite(backgroundWhite), _qrCodeGenerated(false) { setupRenderJob(); }
 
 #ifdef QRCODE_WIDGET_ICON
     // Constructor for QRCodeWidget with icon
     QRCodeWidget(i2cDisplay* display, const std::string& url, bool backgroundWhite, Icon iconBitmap)
-        : _display(display), _url(url), _iconBitmap(iconBitmap), _backgroundWhite(backgroundWhite), _qrCodeGenerated(false) {}
+        : Widget(DisplayMode::QR_CODE), _display(display), _url(url), _iconBitmap(iconBitmap), _backgroundWhite(backgroundWhite), _qrCodeGenerated(false) { setupRenderJob(); }
 #endif
+    ~QRCodeWidget() { delete _encoder; }                       // Destructor. Frees the encoder of an unfinished encoding
+    QRCodeWidget(const QRCodeWidget&) = delete;                // The render steps are bound to the widget
+    QRCodeWidget& operator=(const QRCodeWidget&) = delete;
+
     // Set the URL for the QR code
-    void setUrl(const std::string& url) { _url = url; }
+    void setUrl(const std::string& url) { _url = url; _qrcode = nullptr; reset(); }
+    // Set an encoded QR code instead of the URL, e.g. a QRCodeEncoder::Bitmap encoded at compile time. Must stay valid
+    void setQRCode(const uint8_t* qrcode) { _qrcode = qrcode; reset(); }
     // Get the URL for the QR code
     const std::string getUrl() { return _url; }
 
@@ -111,39 +130,117 @@ class QRCodeWidget
     // Draw the QR code on the display and optionally place the icon
     // The display and icon are centered on the display. The icon is optional. The background color can be set to white or black.
     // Before calling this method, the URL and icon should be set using the `setUrl` and `setIcon` methods. The display should be set using the `setDisplay` method.
+    // The text is encoded in one go, if it is not cached. drawWidget() encodes it step by step instead.
     void generateQRCode()
     {
-        uint8_t qrcode[qrcodegen_BUFFER_LEN_MAX];
-        uint8_t tempBuffer[qrcodegen_BUFFER_LEN_MAX];
-
-        // Generate QR code data
-        if (!qrcodegen_encodeText(_url.c_str(), tempBuffer, qrcode,
-                                  qrcodegen_Ecc_LOW, // Error correction level
-                                  // qrcodegen_Ecc_HIGH,  // Error correction level
-                                  3,                   // We will Fix is to 3! Minimum QR Code Version (Min: 1)
-                                  3,                   // We will Fix is to 3! Maximum QR Code Version (Max: 40)
-                                  qrcodegen_Mask_AUTO, // Automatic mask
-                                  true                 // Boost the mask
-                                  ))
+        // Generate QR code data. A QR code set with setQRCode() needs no encoding at all, a text shown before
+        // (by any QR code widget) is taken from the cache without encoding
+        const uint8_t* qrcode = (_qrcode != nullptr) ? _qrcode : QRCodeCache::get(_url, ECC, VERSION_MIN, VERSION_MAX);
+        if (qrcode == nullptr)
         {
             return; // Error generating QR code
         }
+        showQRCode(qrcode);
+    } // End of generateQRCode
 
-        // Calculate QR code size and pixel size
-        const int qrSize = qrcodegen_getSize(qrcode); // QR code size in modules (e.g., 21x21 moduiles for Version 1)
+  protected:
+    // Draw the QR code. It is generated only once, to avoid unnecessary processing. A text which is not cached is
+    // encoded step by step (see setupRenderJob()), a placeholder is shown until the encoding is completed
+    void drawWidget(i2cDisplay* display) override
+    {
+        if (_qrCodeGenerated) return;
 
-        // Calculate QR code size and pixel size based on display size
-        const uint8_t pixelSize = std::min(_display->GetDisplayWidth() / qrSize, _display->GetDisplayHeight() / qrSize);
-        const int qrPixelSize = qrSize * pixelSize; // Calculate QR code size in pixels
+        // Fallbacks for the QR code URL and icon
+        if (_url.empty() && _qrcode == nullptr) _qrcode = qrCodeOpenKNX.qrcode; // fallback to the OpenKNX website! Encoded at compile time
+
+#ifdef QRCODE_WIDGET_ICON
+        // No icon for the QR code, since there is no space for it! For testing, we could use the OpenKNX icon on the left or right side of the QR code
+        if (_iconBitmap.bitmapData == nullptr) _iconBitmap = {logoICON_SMALL_OKNX, LOGO_WIDTH_ICON_SMALL_OKNX, LOGO_HEIGHT_ICON_SMALL_OKNX}; // Default icon for the QR code
+#endif
+
+        _display = display;
+        if (!_renderJob.busy()) _renderJob.restart(); // Start (again), e.g. after the QR code did not fit on the display
+        _renderJob.run(display, _renderBudgetUs);
+    }
+
+  private:
+    // Split the encoding into steps: the data encoding, the ECC and module placement and each of the 8 mask
+    // evaluations. The steps after the first one do nothing if the QR code is already known
+    void setupRenderJob()
+    {
+        _renderJob.add([this](i2cDisplay* display) {
+            const uint8_t* qrcode = (_qrcode != nullptr) ? _qrcode : QRCodeCache::find(_url, ECC, VERSION_MIN, VERSION_MAX);
+            if (qrcode != nullptr)
+            {
+                showQRCode(qrcode); // Nothing to encode
+                return true;
+            }
+            drawPlaceholder();
+            if (_encoder == nullptr) _encoder = new QRCodeEncoder();
+            return true;
+        });
+        _renderJob.add([this](i2cDisplay* display) {
+            if (_encoder == nullptr) return true;
+            if (!_encoder->encodeData(_url.c_str(), ECC, VERSION_MIN, VERSION_MAX, true))
+            {
+                releaseEncoder();        // Text too long for VERSION_MAX
+                _qrCodeGenerated = true; // Keep the placeholder, do not try again
+            }
+            _mask = 0;
+            return true;
+        });
+        _renderJob.add([this](i2cDisplay* display) {
+            if (_encoder != nullptr) _encoder->drawCodewords(); // ECC and module placement
+            return true;
+        });
+        _renderJob.add([this](i2cDisplay* display) {
+            if (_encoder == nullptr) return true;
+            _encoder->evaluateMask(_mask); // One mask per step
+            return ++_mask == 8;
+        });
+        _renderJob.add([this](i2cDisplay* display) {
+            if (_encoder == nullptr) return true;
+            _encoder->finish();
+            showQRCode(QRCodeCache::store(_url, ECC, VERSION_MIN, VERSION_MAX, _encoder->qrcode())); // Shared with the other QR code widgets
+            releaseEncoder();
+            return true;
+        });
+    }
+
+    // Drop an unfinished encoding and draw the QR code again with the next draw() call
+    void reset()
+    {
+        releaseEncoder();
+        _renderJob.stop();
+        _qrCodeGenerated = false;
+    }
+
+    // Free the encoder. It is only allocated while a text is encoded
+    void releaseEncoder()
+    {
+        delete _encoder;
+        _encoder = nullptr;
+    }
+
+    // Calculate the scale and the position of a QR code with qrSize modules. Returns the scale, 0 if it does not fit
+    uint8_t layout(int qrSize)
+    {
+        // Calculate QR code size and pixel size based on display size. The largest integer scale which leaves the quiet zone free
+        const int displaySize = std::min(_display->GetDisplayWidth(), _display->GetDisplayHeight());
+        uint8_t pixelSize = displaySize / (qrSize + 2 * QRCODE_QUIET_ZONE);
+        if (pixelSize == 0) pixelSize = displaySize / qrSize; // Too small for the quiet zone. Use the remaining space
+        if (pixelSize == 0) return 0;                         // The QR code does not fit on the display
+        const int qrPixelSize = qrSize * pixelSize;           // Calculate QR code size in pixels
+        const int quietZone = std::min(QRCODE_QUIET_ZONE * pixelSize, _display->GetDisplayWidth() - qrPixelSize);
 
         // QR code alignment x offset left
         if (_qrAlignment.alignment & ALIGN_LEFT) // QR code alignment x offset left
         {
-            _qrAlignment.offsetX = 0;
+            _qrAlignment.offsetX = quietZone;
         }
         else if (_qrAlignment.alignment & ALIGN_RIGHT) // QR code alignment x offset right
         {
-            _qrAlignment.offsetX = _display->GetDisplayWidth() - qrPixelSize; // QR code alignment x offset right
+            _qrAlignment.offsetX = _display->GetDisplayWidth() - qrPixelSize - quietZone; // QR code alignment x offset right
         }
         else
         {
@@ -151,21 +248,48 @@ class QRCodeWidget
         }
 
         _qrAlignment.offsetY = (_display->GetDisplayHeight() - qrPixelSize) / 2; // QR code alignment y always centered
+        return pixelSize;
+    }
 
-        _display->display->clearDisplay();                                                                   // Clear display buffer
-        _display->display->setTextColor(_backgroundWhite ? BLACK : WHITE, _backgroundWhite ? WHITE : BLACK); // Set text color based on background color
+    // Show a frame with "QR code" where the QR code will be shown, while the text is encoded
+    void drawPlaceholder()
+    {
+        Adafruit_SSD1306* gfx = _display->display;
+        const uint16_t color = _backgroundWhite ? BLACK : WHITE;
+        const int qrSize = VERSION_MIN * 4 + 17; // Size of the smallest version. Usually the final size
+        const uint8_t pixelSize = layout(qrSize);
 
-        // Draw every QR code pixel on the display
-        for (int y = 0; y < qrSize; y++)
+        gfx->fillScreen(_backgroundWhite ? WHITE : BLACK);
+        if (pixelSize != 0)
         {
-            for (int x = 0; x < qrSize; x++)
+            const int qrPixelSize = qrSize * pixelSize;
+            gfx->drawRect(_qrAlignment.offsetX, _qrAlignment.offsetY, qrPixelSize, qrPixelSize, color);
+
+            static const char text[] = "QR code";
+            const int textWidth = (sizeof(text) - 1) * FastText::GLYPH_WIDTH;
+            if (textWidth + 4 <= qrPixelSize)
             {
-                _display->display->drawRect(_qrAlignment.offsetX + x * pixelSize,               // X position
-                                            _qrAlignment.offsetY + y * pixelSize,               // Y position
-                                            pixelSize, pixelSize,                               // Width and height
-                                            qrcodegen_getModule(qrcode, x, y) ? WHITE : BLACK); // Color of the pixel
+                FastText::print(gfx, _qrAlignment.offsetX + (qrPixelSize - textWidth) / 2,
+                                _qrAlignment.offsetY + (qrPixelSize - FastText::GLYPH_HEIGHT) / 2, text, color, color);
             }
         }
+        _display->displayBuff(); // Display the buffer on the display
+    }
+
+    // Draw an encoded QR code and the icon, and show it on the display
+    void showQRCode(const uint8_t* qrcode)
+    {
+        // Calculate QR code size and pixel size
+        const int qrSize = qrcodegen_getSize(qrcode); // QR code size in modules (e.g., 21x21 moduiles for Version 1)
+
+        const uint8_t pixelSize = layout(qrSize);     // Scale and position on the display
+        if (pixelSize == 0) return;                   // The QR code does not fit on the display
+#ifdef QRCODE_WIDGET_ICON
+        const int qrPixelSize = qrSize * pixelSize; // Calculate QR code size in pixels
+#endif
+
+        _display->display->setTextColor(_backgroundWhite ? BLACK : WHITE, _backgroundWhite ? WHITE : BLACK); // Set text color based on background color
+        drawModules(qrcode, qrSize, pixelSize);                                                              // Draw the QR code and the background of the whole display
 #ifdef QRCODE_WIDGET_ICON
         // Draw the icon in the center of the QR code. The icon is optional. And not recommended for small displays!
         if (_iconBitmap.bitmapData != nullptr)
@@ -187,23 +311,75 @@ class QRCodeWidget
 
         // Set the flag that the QR code was generated and is displayed
         _qrCodeGenerated = true;
-    } // End of generateQRCode
+    }
 
-    void draw()
+    // Draw the modules of the QR code scaled into the framebuffer and fill the rest of the display (incl. the quiet zone)
+    // with the background color. Every page byte is computed once from the module rows it covers, so a page costs one
+    // byte per display column instead of a GFX call per module.
+    void drawModules(const uint8_t* qrcode, int qrSize, uint8_t scale)
     {
-        if (!_qrCodeGenerated) 
+        Adafruit_SSD1306* gfx = _display->display;
+        const uint16_t darkColor = _backgroundWhite ? BLACK : WHITE; // Color of the dark modules
+
+        if (gfx->getRotation() != 0) // The page layout is only valid without rotation. Use solid rectangles instead
         {
-            generateQRCode(); // Generate the QR code only once, to avoid unnecessary processing
-            _display->displayBuff(); // Display the buffer on the display in the next loop
+            gfx->fillScreen(_backgroundWhite ? WHITE : BLACK);
+            for (int y = 0; y < qrSize; y++)
+            {
+                for (int x = 0; x < qrSize; x++)
+                {
+                    if (QRCodeEncoder::getModule(qrcode, x, y))
+                        gfx->fillRect(_qrAlignment.offsetX + x * scale, _qrAlignment.offsetY + y * scale, scale, scale, darkColor);
+                }
+            }
+            return;
+        }
+
+        uint8_t* buffer = gfx->getBuffer();
+        const int16_t width = gfx->width();
+        const int16_t codeHeight = qrSize * scale;
+        const uint8_t invert = (darkColor == WHITE) ? 0x00 : 0xFF; // Page byte = dark modules XOR invert
+        int8_t moduleRow[8];                                        // Module row of each bit of the page. -1: outside of the code
+
+        for (int16_t page = 0; page < gfx->height() / 8; page++)
+        {
+            uint8_t* dst = buffer + page * width;
+            memset(dst, invert, width); // Background and quiet zone
+
+            bool inside = false;
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                const int16_t y = page * 8 + bit - _qrAlignment.offsetY;
+                moduleRow[bit] = (y >= 0 && y < codeHeight) ? y / scale : -1;
+                inside |= (moduleRow[bit] >= 0);
+            }
+            if (!inside) continue;
+
+            dst += _qrAlignment.offsetX;
+            for (int x = 0; x < qrSize; x++, dst += scale)
+            {
+                uint8_t dark = 0;
+                bool isDark = false;
+                for (uint8_t bit = 0; bit < 8; bit++)
+                {
+                    if (moduleRow[bit] < 0) continue;
+                    if (bit == 0 || moduleRow[bit] != moduleRow[bit - 1]) isDark = QRCodeEncoder::getModule(qrcode, x, moduleRow[bit]); // Rows repeat with the scale
+                    if (isDark) dark |= (1 << bit);
+                }
+                if (dark != 0) memset(dst, dark ^ invert, scale);
+            }
         }
     }
 
-  private:
     QRcodeAlignment _qrAlignment = {ALIGN_CENTER, 0, 0}; // QR code alignment settings
     i2cDisplay* _display;                                // Display object
     std::string _url;                                    // URL for the QR code
+    const uint8_t* _qrcode = nullptr;                    // Encoded QR code set with setQRCode(). nullptr: encode the URL
     bool _backgroundWhite;                               // Background color for the QR code
     bool _qrCodeGenerated;                               // Flag to indicate if the QR code was generated and displayed
+    RenderJob _renderJob;                                // Time-sliced encoding and drawing
+    QRCodeEncoder* _encoder = nullptr;                   // Encoder of the running encoding. nullptr if nothing is encoded
+    uint8_t _mask = 0;                                   // Next mask to evaluate
 #ifdef QRCODE_WIDGET_ICON
     Icon _iconBitmap = {nullptr, 0, 0}; // Icon for the QR code
 #endif
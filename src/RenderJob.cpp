@@ -0,0 +1,42 @@
+#include "RenderJob.h"
+
+/**
+ * @brief Append a step to the job. The job is not (re)started, use restart() for that.
+ *
+ * @param step the step to append
+ */
+void RenderJob::add(Step step)
+{
+    const bool idle = !busy();
+    _steps.push_back(step);
+    if (idle) stop(); // Keep an idle job idle
+}
+
+/**
+ * @brief Remove all steps of the job.
+ */
+void RenderJob::clear()
+{
+    _steps.clear();
+    _current = 0;
+}
+
+/**
+ * @brief Run the steps of the job until the job is completed or the time budget is used up. The current step is
+ *        called at least once, even if it takes longer than the budget. Steps which return false are called
+ *        again, in this run() if the budget allows, otherwise in the next one.
+ *
+ * @param display pointer to the i2cDisplay object
+ * @param budgetUs time budget in microseconds
+ * @return true if the job is completed (or there was nothing to do)
+ */
+bool RenderJob::run(i2cDisplay *display, uint32_t budgetUs)
+{
+    const uint32_t start = micros();
+    while (busy())
+    {
+        if (_steps[_current](display)) _current++;
+        if (micros() - start >= budgetUs) break;
+    }
+    return !busy();
+}
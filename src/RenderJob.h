@@ -0,0 +1,47 @@
+#pragma once
+/**
+ * @file        RenderJob.h
+ * @brief       Time-sliced rendering of widgets, split into resumable draw steps
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * A widget describes its drawing as a sequence of steps. Each step is called until it returns true, so an
+ * expensive step (e.g. decoding an image) can do a small part of its work per call and continue on the next
+ * call. run() executes the steps until the time budget of the current loop() call is used up and continues
+ * in the next loop() call. At least one step call is done per run(), so a job always makes progress.
+ *
+ * Example:
+ *   _renderJob.add([](i2cDisplay *display) { display->display->clearDisplay(); return true; });
+ *   _renderJob.add([this](i2cDisplay *display) { return _decoder.decodeRows(8); });
+ *   _renderJob.add([](i2cDisplay *display) { display->displayBuff(); return true; });
+ *   _renderJob.restart();
+ *   ...
+ *   _renderJob.run(display, RENDER_BUDGET_US); // in loop()
+ */
+#include "i2c-Display.h"
+#include <functional>
+#include <vector>
+
+#define RENDER_BUDGET_US 1000 // Default time budget for rendering in one loop() call (in microseconds)
+
+class RenderJob
+{
+  public:
+    typedef std::function<bool(i2cDisplay *display)> Step; // Draw step. Returns true if the step is completed
+
+    void add(Step step);                                          // Append a step to the job
+    void clear();                                                 // Remove all steps
+    inline void restart() { _current = 0; }                       // Start (again) with the first step
+    inline void stop() { _current = _steps.size(); }              // Stop the job. Remaining steps are skipped
+    inline bool busy() const { return _current < _steps.size(); } // True if there are steps left to run
+    inline bool empty() const { return _steps.empty(); }          // True if no steps are defined
+
+    // Run the steps within the time budget. Returns true if the job is completed
+    bool run(i2cDisplay *display, uint32_t budgetUs = RENDER_BUDGET_US);
+
+  private:
+    std::vector<Step> _steps; // Steps of the job
+    size_t _current = 0;      // Index of the current step. _steps.size() if the job is completed
+};
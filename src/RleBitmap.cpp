@@ -0,0 +1,115 @@
+#include "RleBitmap.h"
+
+/**
+ * @brief Start decoding a compressed bitmap into a framebuffer in the SSD1306 page layout.
+ *        The rows are decoded with decodeRows(), which can be called across multiple loop() calls.
+ *
+ * @param bitmap the compressed bitmap
+ * @param buffer pointer to the framebuffer, e.g. display->display->getBuffer()
+ * @param bufWidth width of the framebuffer in pixels
+ * @param bufHeight height of the framebuffer in pixels
+ * @param x position of the image. Columns outside of the framebuffer are skipped
+ * @param y position of the image. The image must fit completely into the framebuffer rows
+ * @return true if the decoding was started, false if the image does not fit vertically
+ */
+bool RleDecoder::begin(const RleBitmap &bitmap, uint8_t *buffer, int16_t bufWidth, int16_t bufHeight, int16_t x, int16_t y)
+{
+    _bitmap = bitmap;
+    _bufWidth = bufWidth;
+    _posX = x;
+    _offset = 0;
+    _x = 0;
+    _y = 0;
+    _left = 0;
+
+    if (buffer == nullptr || y < 0 || y + bitmap.height > bufHeight)
+    {
+        _y = _bitmap.height; // Nothing to do. The previous rows must be readable for decoding!
+        return false;
+    }
+
+    _page = buffer + (y / 8) * bufWidth; // First page of the image
+    _mask = 1 << (y & 7);                // Bit of the first row
+    return true;
+}
+
+/**
+ * @brief Write the next pixel of the image. The stored value is the XOR with the pixel above,
+ *        which is read back from the framebuffer.
+ *
+ * @param delta the decoded (XOR) value of the pixel
+ */
+inline void RleDecoder::putPixel(uint8_t delta)
+{
+    const int16_t px = _posX + _x;
+    if (px >= 0 && px < _bufWidth)
+    {
+        uint8_t *dst = _page + px;
+        uint8_t above = 0;
+        if (_y > 0)
+        {
+            above = (_mask == 0x01) ? (dst[-_bufWidth] & 0x80) : (*dst & (_mask >> 1)); // Previous row, maybe in the previous page
+        }
+
+        if ((above != 0) != (delta != 0))
+            *dst |= _mask;
+        else
+            *dst &= ~_mask;
+    }
+
+    if (++_x >= _bitmap.width) // Next row
+    {
+        _x = 0;
+        _y++;
+        _mask <<= 1;
+        if (_mask == 0)
+        {
+            _mask = 0x01;
+            _page += _bufWidth;
+        }
+    }
+}
+
+/**
+ * @brief Decode the next rows of the image into the framebuffer.
+ *
+ * @param rows number of rows to decode in this call
+ * @return true if the image is completely decoded
+ */
+bool RleDecoder::decodeRows(uint16_t rows)
+{
+    const uint16_t lastRow = MIN(_y + rows, _bitmap.height);
+
+    while (_y < lastRow)
+    {
+        if (_left == 0) // Fetch the next token
+        {
+            if (_offset >= _bitmap.size)
+            {
+                _y = _bitmap.height; // Truncated stream. Stop here!
+                break;
+            }
+            _token = pgm_read_byte(_bitmap.data + _offset++);
+            _left = (_token & 0x80) ? (_token & 0x3F) + 1 : 7;
+        }
+
+        if (_token & 0x80) // Run of equal pixels
+        {
+            const uint8_t delta = (_token >> 6) & 0x01;
+            while (_left && _y < lastRow)
+            {
+                putPixel(delta);
+                _left--;
+            }
+        }
+        else // Literal pixels
+        {
+            while (_left && _y < lastRow)
+            {
+                putPixel((_token >> (_left - 1)) & 0x01);
+                _left--;
+            }
+        }
+    }
+    return done();
+}
@@ -0,0 +1,60 @@
+#pragma once
+/**
+ * @file        RleBitmap.h
+ * @brief       Run-length compressed monochrome bitmaps with a streaming decoder into the SSD1306 framebuffer
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Asset format:
+ * The image is read row by row, left to right (like the bitmaps for drawBitmap). Every pixel is stored as the
+ * XOR with the pixel directly above it (the first row against 0), so vertically repeating areas become long
+ * runs of zeros. The resulting bit stream is stored as a sequence of tokens:
+ *
+ *   1cnnnnnn : Run of (nnnnnn + 1) pixels (1..64) with the value c
+ *   0bbbbbbb : Literal of 7 pixels, first pixel in bit 6
+ *
+ * The decoder writes straight into the page layout of the display buffer and reads the previous row back from
+ * there, so no intermediate buffer is needed. It can be stopped after any number of rows and resumed in the
+ * next loop() call.
+ *
+ * Conversion: Take the bitmap from image2cpp (horizontal, 1 bit per pixel) and run tools/rle_encode.py, which
+ * prints the token stream described above as C array. E.g. logo_OpenKNX: 896 bytes raw -> 399 bytes compressed:
+ *   python3 tools/rle_encode.py src/DisplayIcons.h logo_OpenKNX 106 64
+ * With --check it verifies that an existing <name>_rle array matches the bitmap.
+ */
+#include <Arduino.h>
+
+struct RleBitmap
+{
+    const uint8_t *data; // Compressed token stream (PROGMEM)
+    uint16_t size;       // Size of the token stream in bytes
+    uint8_t width;       // Width of the image in pixels
+    uint8_t height;      // Height of the image in pixels
+};
+
+class RleDecoder
+{
+  public:
+    // Start decoding the bitmap into the buffer at the given position. The image must fit the buffer vertically.
+    bool begin(const RleBitmap &bitmap, uint8_t *buffer, int16_t bufWidth, int16_t bufHeight, int16_t x, int16_t y);
+    bool decodeRows(uint16_t rows);                                    // Decode the next rows. Returns true if the image is complete
+    inline bool decodeAll() { return decodeRows(_bitmap.height); }    // Decode the (remaining) image in one go
+    inline bool done() const { return _y >= _bitmap.height; }          // True if the image is completely decoded
+    inline uint8_t rowsDone() const { return _y; }                     // Number of rows decoded so far
+
+  private:
+    void putPixel(uint8_t delta); // Write the next pixel to the framebuffer
+
+    RleBitmap _bitmap = {nullptr, 0, 0, 0}; // Bitmap currently decoded
+    uint8_t *_page = nullptr;               // Start of the page of the current row in the buffer
+    int16_t _bufWidth = 0;                  // Width of the framebuffer in pixels
+    int16_t _posX = 0;                      // X position of the image in the framebuffer
+    uint16_t _offset = 0;                   // Read position in the token stream
+    uint8_t _x = 0;                         // Current column in the image
+    uint8_t _y = 0;                         // Current row in the image
+    uint8_t _mask = 0;                      // Bit of the current row in the page byte
+    uint8_t _token = 0;                     // Current token
+    uint8_t _left = 0;                      // Pixels left of the current token
+};
@@ -0,0 +1,976 @@
+#include "Screensavers.h"
+#include "FastRandom.h"
+#include "FixedMath.h"
+
+#ifdef MATRIX_SCREENSAVER
+
+// Names of the OpenKNX team and the end text for the team intro
+const char *const TeamIntroWidget::DEVELOPER_NAMES[] = {"traxanos", "jeff25", "Ing-Dom", "mumpf", "thewhobox", "willisurf", "cornelius-koepp", "ab-tools", "GeminiServer", "mgeramb", "Smart-MF"};
+const uint8_t TeamIntroWidget::DEVELOPER_COUNT = sizeof(TeamIntroWidget::DEVELOPER_NAMES) / sizeof(TeamIntroWidget::DEVELOPER_NAMES[0]);
+const char TeamIntroWidget::END_TEXT[] = "Powered by OpenKNX";
+
+uint8_t ClockScreensaver::_digitGlyphs[ClockScreensaver::DIGIT_GLYPHS][FastText::GLYPH_WIDTH];
+bool ClockScreensaver::_digitsCached = false;
+
+uint32_t ScreensaverMemory::_used = 0;
+uint32_t ScreensaverMemory::_peak = 0;
+
+/**
+ * @brief Get a block for the state of a screensaver. The block is zeroed, so a screensaver can use the allocation
+ *        itself as "initialized" flag.
+ *
+ * @param size size of the state in bytes
+ * @return void* pointer to the block, nullptr if out of memory
+ */
+void *ScreensaverMemory::acquire(uint16_t size)
+{
+    const uint32_t total = sizeof(Header) + size;
+    Header *header = static_cast<Header *>(calloc(1, total));
+    if (header == nullptr) return nullptr;
+
+    header->size = total;
+    _used += total;
+    _peak = MAX(_peak, _used);
+    return header + 1;
+}
+
+/**
+ * @brief Return a block of acquire().
+ *
+ * @param block the block. nullptr is ignored
+ */
+void ScreensaverMemory::release(void *block)
+{
+    if (block == nullptr) return;
+
+    Header *header = static_cast<Header *>(block) - 1;
+    _used -= header->size;
+    free(header);
+}
+
+/**
+ * @brief Display a matrix-style screensaver on the screen. The screensaver
+ * consists of falling characters that move down the screen.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void MatrixScreensaver::drawWidget(i2cDisplay *display)
+{
+    // CP437 character set
+    static const char cp437[] = {
+        0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+        // ' ', '!', '"', '#', '$', '%', '&', '\'', '(', ')', '*', '+', ',', '-', '.', '/'
+        0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+        // '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', ';', '<', '=', '>', '?'
+        0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+        // '@', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P'
+        0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+        // 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '[', '\\', ']', '^', '_', '`'
+        0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F, 0x70,
+        // 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p'
+        0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0xC4, 0xB1,
+        // 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '{', '|', '}', '~', '█', '▓'
+        0xB0, 0xB1, 0xB2, 0xB3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9,
+        // '▒', '░', '▌', '▐', '▄', '▔', '▕', '▁', '▏', '▎'
+    };
+
+    const uint16_t COLUMNS = display->GetDisplayWidth() / COLUMN_WIDTH;
+    if (_dropPos == nullptr)
+    {
+        _dropPos = static_cast<uint8_t *>(ScreensaverMemory::acquire(COLUMNS * MAX_DROPS));
+        if (_dropPos == nullptr) return; // Out of memory
+        for (uint16_t i = 0; i < COLUMNS * MAX_DROPS; i++)
+        {
+            _dropPos[i] = displayRandom.below(64);
+        }
+    }
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate >= FALL_SPEED)
+    {
+        _lastUpdate = currentTime;
+        display->display->clearDisplay(); // Every character changes in every frame, clearing is cheaper than erasing them one by one
+
+        for (uint16_t x = 0; x < COLUMNS; x++)
+        {
+            for (uint16_t drop = 0; drop < MAX_DROPS; drop++)
+            {
+                if (_dropPos[x * MAX_DROPS + drop] < display->GetDisplayHeight())
+                {
+                    _dropPos[x * MAX_DROPS + drop] += COLUMN_WIDTH;
+                }
+                else
+                {
+                    _dropPos[x * MAX_DROPS + drop] = 0;
+                }
+                display->display->setCursor(x * COLUMN_WIDTH, _dropPos[x * MAX_DROPS + drop]);
+                display->display->setTextColor(SSD1306_WHITE);
+                display->display->setTextSize(1);
+                display->display->write(cp437[displayRandom.below(sizeof(cp437))]);
+            }
+        }
+        display->displayBuff();
+    }
+}
+
+/**
+ * @brief Display a Pong-style screensaver on the screen. The screensaver
+ * consists of two paddles and a ball that moves between the paddles.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void PongScreensaver::drawWidget(i2cDisplay *display)
+{
+    const uint8_t PADDLE_WIDTH = 2;   // Paddle width in pixels
+    const uint8_t PADDLE_HEIGHT = 10; // Paddle height in pixels
+    const uint8_t BALL_SIZE = 2;      // Ball size in pixels
+    const uint16_t SCREEN_WIDTH = display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = display->GetDisplayHeight();
+
+    if (!_initialized)
+    {
+        _paddleLeftY = SCREEN_HEIGHT / 2 - PADDLE_HEIGHT / 2;
+        _paddleRightY = SCREEN_HEIGHT / 2 - PADDLE_HEIGHT / 2;
+        _ballX = SCREEN_WIDTH / 2;
+        _ballY = SCREEN_HEIGHT / 2;
+        _initialized = true;
+    }
+
+    // Check if enough time has passed to update the screensaver
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate >= 50)
+    {
+        // Erase the paddles and the ball at the old positions, or everything if someone else has drawn in the meantime
+        if (display->claim(this))
+        {
+            display->display->clearDisplay();
+            display->markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+        }
+        else
+        {
+            display->display->fillRect(0, _paddleLeftY, PADDLE_WIDTH, PADDLE_HEIGHT, BLACK);
+            display->display->fillRect(SCREEN_WIDTH - PADDLE_WIDTH, _paddleRightY, PADDLE_WIDTH, PADDLE_HEIGHT, BLACK);
+            display->display->fillRect(_ballX, _ballY, BALL_SIZE, BALL_SIZE, BLACK);
+            display->markDirty(0, _paddleLeftY, PADDLE_WIDTH, PADDLE_HEIGHT);
+            display->markDirty(SCREEN_WIDTH - PADDLE_WIDTH, _paddleRightY, PADDLE_WIDTH, PADDLE_HEIGHT);
+            display->markDirty(_ballX, _ballY, BALL_SIZE, BALL_SIZE);
+        }
+
+        // Ball movement
+        _ballX += _ballSpeedX;
+        _ballY += _ballSpeedY;
+
+        // Ball collides with top and bottom walls
+        if (_ballY <= 0 || _ballY >= SCREEN_HEIGHT - BALL_SIZE)
+        {
+            _ballSpeedY = -_ballSpeedY; // Change ball direction
+        }
+
+        // Ball collides with paddles
+        if (_ballX <= PADDLE_WIDTH && _ballY >= _paddleLeftY && _ballY <= _paddleLeftY + PADDLE_HEIGHT)
+        {
+            _ballSpeedX = -_ballSpeedX; // Change ball direction
+        }
+        if (_ballX >= SCREEN_WIDTH - PADDLE_WIDTH - BALL_SIZE && _ballY >= _paddleRightY && _ballY <= _paddleRightY + PADDLE_HEIGHT)
+        {
+            _ballSpeedX = -_ballSpeedX; // Change ball direction
+        }
+
+        // Ball collides with left and right walls (reset ball)
+        if (_ballX <= 0 || _ballX >= SCREEN_WIDTH)
+        {
+            _ballX = SCREEN_WIDTH / 2;
+            _ballY = SCREEN_HEIGHT / 2;
+            _ballSpeedX = -_ballSpeedX;
+            _ballSpeedY = (displayRandom.coin() ? 1 : -1) * displayRandom.range(1, 3); // Random direction
+        }
+
+        // Paddles follow the ball
+        if (_ballY < _paddleLeftY + PADDLE_HEIGHT / 2)
+        {
+            _paddleLeftY -= 1;
+        }
+        else if (_ballY > _paddleLeftY + PADDLE_HEIGHT / 2)
+        {
+            _paddleLeftY += 1;
+        }
+
+        if (_ballY < _paddleRightY + PADDLE_HEIGHT / 2)
+        {
+            _paddleRightY -= 1;
+        }
+        else if (_ballY > _paddleRightY + PADDLE_HEIGHT / 2)
+        {
+            _paddleRightY += 1;
+        }
+
+        // Constrain paddle movement to the screen area
+        _paddleLeftY = constrain(_paddleLeftY, 0, SCREEN_HEIGHT - PADDLE_HEIGHT);
+        _paddleRightY = constrain(_paddleRightY, 0, SCREEN_HEIGHT - PADDLE_HEIGHT);
+
+        // Draw left paddle
+        display->display->fillRect(0, _paddleLeftY, PADDLE_WIDTH, PADDLE_HEIGHT, WHITE);
+        display->markDirty(0, _paddleLeftY, PADDLE_WIDTH, PADDLE_HEIGHT);
+
+        // Draw right paddle
+        display->display->fillRect(SCREEN_WIDTH - PADDLE_WIDTH, _paddleRightY, PADDLE_WIDTH, PADDLE_HEIGHT, WHITE);
+        display->markDirty(SCREEN_WIDTH - PADDLE_WIDTH, _paddleRightY, PADDLE_WIDTH, PADDLE_HEIGHT);
+
+        // Draw ball
+        display->display->fillRect(_ballX, _ballY, BALL_SIZE, BALL_SIZE, WHITE);
+        display->markDirty(_ballX, _ballY, BALL_SIZE, BALL_SIZE);
+
+        // Update display with changes
+        display->displayDirty();
+
+        // Update the last update time
+        _lastUpdate = currentTime;
+    }
+}
+
+void ClockScreensaver::drawWidget(i2cDisplay *display)
+{
+    const unsigned long UPDATE_INTERVAL = 1000; // 1 second
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate < UPDATE_INTERVAL)
+    {
+        return; // Not yet time to update
+    }
+    _lastUpdate = currentTime; // Reset timer
+
+    const uint16_t SCREEN_WIDTH = display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = display->GetDisplayHeight();
+    const uint16_t CENTER_X = SCREEN_WIDTH / 2;
+    const uint16_t CENTER_Y = SCREEN_HEIGHT / 2;
+    const uint16_t CLOCK_RADIUS = min(SCREEN_WIDTH, SCREEN_HEIGHT) / 2 - 5; // For round clock
+
+    uint16_t hours, minutes, seconds;
+
+    // Get the time or uptime
+    if (openknx.time.isValid())
+    {
+        auto time = openknx.time.getUtcTime();
+        hours = time.hour;
+        minutes = time.minute;
+        seconds = time.second;
+    }
+    else
+    {
+        uint32_t secs = uptime();
+        seconds = secs % 60;
+        secs /= 60;
+        minutes = secs % 60;
+        secs /= 60;
+        hours = secs % 24;
+    }
+
+    // Draw the clock
+    if (_rounded)
+    {
+        // Round clock with dial
+        display->display->clearDisplay();
+        display->display->drawCircle(CENTER_X, CENTER_Y, CLOCK_RADIUS, WHITE);
+
+        // Hands: angles in FixedMath units, 12 o'clock is a quarter turn before 0 (3 o'clock)
+        const uint16_t TOP = FixedMath::ANGLE_FULL - FixedMath::ANGLE_QUARTER;
+
+        // Hour hand
+        uint16_t angleHour = TOP + ((hours % 12) * 60 + minutes) * FixedMath::ANGLE_FULL / 720;
+        int16_t hourX = CENTER_X + FixedMath::mulQ15(CLOCK_RADIUS / 2, FixedMath::cos(angleHour));
+        int16_t hourY = CENTER_Y + FixedMath::mulQ15(CLOCK_RADIUS / 2, FixedMath::sin(angleHour));
+        display->display->drawLine(CENTER_X, CENTER_Y, hourX, hourY, WHITE);
+
+        // Minute hand
+        uint16_t angleMin = TOP + (minutes * 60 + seconds) * FixedMath::ANGLE_FULL / 3600;
+        int16_t minX = CENTER_X + FixedMath::mulQ15(CLOCK_RADIUS * 4 / 5, FixedMath::cos(angleMin));
+        int16_t minY = CENTER_Y + FixedMath::mulQ15(CLOCK_RADIUS * 4 / 5, FixedMath::sin(angleMin));
+        display->display->drawLine(CENTER_X, CENTER_Y, minX, minY, WHITE);
+
+        // Second hand
+        uint16_t angleSec = TOP + seconds * FixedMath::ANGLE_FULL / 60;
+        int16_t secX = CENTER_X + FixedMath::mulQ15(CLOCK_RADIUS, FixedMath::cos(angleSec));
+        int16_t secY = CENTER_Y + FixedMath::mulQ15(CLOCK_RADIUS, FixedMath::sin(angleSec));
+        display->display->drawLine(CENTER_X, CENTER_Y, secX, secY, WHITE);
+        display->displayBuff();
+    }
+    else
+    {
+        // Rectangular clock
+        char timeString[sizeof(_shownTime)]; // HH:MM:SS
+        snprintf(timeString, sizeof(timeString), "%02u:%02u:%02u", hours, minutes, seconds);
+        drawDigital(display, timeString);
+    }
+}
+
+/**
+ * @brief Draw the digital clock. Only the glyph cells whose character has changed since the last call are written,
+ *        straight from the digit cache into the page in the middle of the display. A tick usually changes one
+ *        digit, i.e. 6 bytes of one page.
+ *
+ * @param display pointer to the i2cDisplay object
+ * @param timeString the time as "HH:MM:SS"
+ */
+void ClockScreensaver::drawDigital(i2cDisplay *display, const char *timeString)
+{
+    Adafruit_SSD1306 *gfx = display->display;
+    const uint8_t len = strlen(timeString);
+    const int16_t startX = (gfx->width() - len * FastText::GLYPH_WIDTH) / 2;
+    const int16_t startY = ((gfx->height() - FastText::GLYPH_HEIGHT) / 2) & ~7; // Page aligned
+
+    if (display->claim(this))
+    {
+        gfx->clearDisplay();
+        display->markDirty(0, 0, gfx->width(), gfx->height());
+        _shownTime[0] = '\0'; // Nothing is shown
+    }
+
+    if (gfx->getRotation() != 0 || startX < 0 || len >= sizeof(_shownTime)) // No page layout, use the slow path
+    {
+        FastText::print(gfx, startX, startY, timeString, SSD1306_WHITE, SSD1306_BLACK);
+        display->markDirty(0, 0, gfx->width(), gfx->height());
+        display->displayDirty();
+        return;
+    }
+
+    if (!_digitsCached)
+    {
+        for (uint8_t i = 0; i < DIGIT_GLYPHS; i++)
+        {
+            FastText::glyphColumns((i < 10) ? '0' + i : ':', _digitGlyphs[i]);
+        }
+        _digitsCached = true;
+    }
+
+    uint8_t *page = gfx->getBuffer() + (startY / 8) * gfx->width() + startX;
+    for (uint8_t i = 0; i < len; i++, page += FastText::GLYPH_WIDTH)
+    {
+        const char c = timeString[i];
+        if (c == _shownTime[i]) continue; // Cell is up to date
+
+        if (c >= '0' && c <= '9')
+            memcpy(page, _digitGlyphs[c - '0'], FastText::GLYPH_WIDTH);
+        else if (c == ':')
+            memcpy(page, _digitGlyphs[10], FastText::GLYPH_WIDTH);
+        else
+            FastText::drawText(gfx, startX + i * FastText::GLYPH_WIDTH, startY, &c, 1, SSD1306_WHITE, SSD1306_BLACK);
+        display->markDirty(startX + i * FastText::GLYPH_WIDTH, startY, FastText::GLYPH_WIDTH, FastText::GLYPH_HEIGHT);
+    }
+    memcpy(_shownTime, timeString, len + 1);
+    display->displayDirty();
+}
+
+void RainScreensaver::drawWidget(i2cDisplay *display)
+{
+    const unsigned long UPDATE_INTERVAL = 25; // Speed of the rain
+    const uint16_t SCREEN_WIDTH = display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = display->GetDisplayHeight();
+    const uint8_t MAX_RAIN_DROPS = 100; // Maximum number of raindrops
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate < UPDATE_INTERVAL)
+    {
+        return; // Not yet time to update
+    }
+    _lastUpdate = currentTime; // Reset timer
+
+    // Current number of drops based on intensity
+    uint8_t dropCount = map(_intensity, 1, 10, 5, MAX_RAIN_DROPS);
+
+    // Initialize drops
+    if (_drops == nullptr)
+    {
+        _drops = static_cast<Drop *>(ScreensaverMemory::acquire(dropCount * sizeof(Drop)));
+        if (_drops == nullptr) return; // Out of memory
+        for (uint8_t i = 0; i < dropCount; i++)
+        {
+            _drops[i].x = displayRandom.below(SCREEN_WIDTH);
+            _drops[i].y = displayRandom.below(SCREEN_HEIGHT);
+        }
+    }
+
+    // Erase the drops at the old positions, or everything if someone else has drawn in the meantime
+    if (display->claim(this))
+    {
+        display->display->clearDisplay();
+        display->markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+    else
+    {
+        for (uint8_t i = 0; i < dropCount; i++)
+        {
+            display->display->drawPixel(_drops[i].x, _drops[i].y, BLACK);
+            display->markDirtyPixel(_drops[i].x, _drops[i].y);
+        }
+    }
+
+    // Draw the rain. Drops are drawn after all are erased, so overlapping drops stay visible
+    for (uint8_t i = 0; i < dropCount; i++)
+    {
+        // Move drop down
+        _drops[i].y++;
+
+        // If the drop reaches the bottom of the screen, restart it at the top
+        if (_drops[i].y >= SCREEN_HEIGHT)
+        {
+            _drops[i].x = displayRandom.below(SCREEN_WIDTH);
+            _drops[i].y = 0;
+        }
+
+        // Draw drop
+        display->display->drawPixel(_drops[i].x, _drops[i].y, WHITE);
+        display->markDirtyPixel(_drops[i].x, _drops[i].y);
+    }
+
+    display->displayDirty();
+}
+
+/**
+ * @brief Number of lit pixels of a tail. The brightness decreases along the tail, only the bright part is drawn.
+ *
+ * @param length length of the tail
+ * @return uint8_t number of pixels from the head which are drawn
+ */
+uint8_t MatrixPixelScreensaver::tailPixels(uint8_t length)
+{
+    uint8_t visible = 0;
+    while (visible < length && 255 - (visible * (255 / length)) > 128) // Brightness decreases
+    {
+        visible++;
+    }
+    return visible;
+}
+
+void MatrixPixelScreensaver::drawWidget(i2cDisplay *display)
+{
+    const unsigned long UPDATE_INTERVAL = map(_intensity, 1, 10, 150, 30); // Speed of the screensaver
+    const uint16_t SCREEN_WIDTH = 128;                                    // display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = 64;                                    // display->GetDisplayHeight();
+    const uint8_t COLUMN_COUNT = SCREEN_WIDTH;                            // One column per pixel width
+    const uint8_t MAX_TAIL_LENGTH = 10;                                   // Maximum length of a "tail"
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate < UPDATE_INTERVAL)
+    {
+        return; // Not yet time to update
+    }
+    _lastUpdate = currentTime; // Reset timer
+
+    // Initialize
+    if (_columns == nullptr)
+    {
+        _columns = static_cast<Column *>(ScreensaverMemory::acquire(COLUMN_COUNT * sizeof(Column)));
+        if (_columns == nullptr) return; // Out of memory
+        for (uint8_t i = 0; i < COLUMN_COUNT; i++)
+        {
+            _columns[i].head = displayRandom.below(SCREEN_HEIGHT);        // Start at random positions
+            _columns[i].length = displayRandom.range(3, MAX_TAIL_LENGTH); // Random length
+        }
+    }
+
+    // Erase the tails of the last frame, or everything if someone else has drawn in the meantime
+    const bool redraw = display->claim(this);
+    if (redraw)
+    {
+        display->display->clearDisplay();
+        display->markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+
+    // Draw the matrix
+    for (uint8_t col = 0; col < COLUMN_COUNT; col++)
+    {
+        Column &column = _columns[col];
+        const uint8_t visible = tailPixels(column.length);
+
+        // Update column position
+        column.head++;
+        if (column.head - column.length >= SCREEN_HEIGHT)
+        {
+            column.head = 0;
+            column.length = displayRandom.range(3, MAX_TAIL_LENGTH); // New length for the next cycle
+
+            // New tail: the old one is already below the screen, draw the new one completely
+            const uint8_t newVisible = tailPixels(column.length);
+            display->display->drawFastVLine(col, column.head - newVisible + 1, newVisible, WHITE);
+            display->markDirty(col, column.head - newVisible + 1, 1, newVisible);
+        }
+        else if (redraw)
+        {
+            display->display->drawFastVLine(col, column.head - visible + 1, visible, WHITE);
+            display->markDirty(col, column.head - visible + 1, 1, visible);
+        }
+        else // The tail moves one pixel down: only the end is erased and the new head is drawn
+        {
+            const int8_t end = column.head - visible; // Last pixel of the old tail
+            if (end >= 0 && end < SCREEN_HEIGHT)
+            {
+                display->display->drawPixel(col, end, BLACK);
+                display->markDirtyPixel(col, end);
+            }
+            if (column.head < SCREEN_HEIGHT)
+            {
+                display->display->drawPixel(col, column.head, WHITE);
+                display->markDirtyPixel(col, column.head);
+            }
+        }
+    }
+
+    // Update Display
+    display->displayDirty();
+}
+
+void CubeScreensaver::drawWidget(i2cDisplay *display)
+{
+    const unsigned long UPDATE_INTERVAL = 50; // Framerate
+    const uint16_t SCREEN_WIDTH = display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = display->GetDisplayHeight();
+    const int CENTER_X = SCREEN_WIDTH / 2;
+    const int CENTER_Y = SCREEN_HEIGHT / 2;
+    const int CUBE_SIZE = 20; // Siue of the cube
+
+    // Pixel of the cube
+    static const int8_t cubeVertices[8][3] = {
+        {-1, -1, -1}, {1, -1, -1}, {1, 1, -1}, {-1, 1, -1}, {-1, -1, 1}, {1, -1, 1}, {1, 1, 1}, {-1, 1, 1}};
+
+    // Corners of the Cube
+    static const uint8_t cubeEdges[12][2] = {
+        {0, 1}, {1, 2}, {2, 3}, {3, 0}, // Fron
+        {4, 5},
+        {5, 6},
+        {6, 7},
+        {7, 4}, // Back
+        {0, 4},
+        {1, 5},
+        {2, 6},
+        {3, 7} // Connections
+    };
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate < UPDATE_INTERVAL)
+    {
+        return; // Wait for the next frame
+    }
+    _lastUpdate = currentTime;
+
+    // Clear Display
+    display->display->clearDisplay();
+
+    // Transf and project the vertices. Coordinates in Q8 (1/256 pixel)
+    const int32_t sinX = FixedMath::sin(_angleX >> 6), cosX = FixedMath::cos(_angleX >> 6);
+    const int32_t sinY = FixedMath::sin(_angleY >> 6), cosY = FixedMath::cos(_angleY >> 6);
+    int16_t projectedVertices[8][2];
+    for (int i = 0; i < 8; i++)
+    {
+        int32_t x = cubeVertices[i][0] * CUBE_SIZE * 256;
+        int32_t y = cubeVertices[i][1] * CUBE_SIZE * 256;
+        int32_t z = cubeVertices[i][2] * CUBE_SIZE * 256;
+
+        // Rotation of the x-axis
+        int32_t tempY = FixedMath::mulQ15(y, cosX) - FixedMath::mulQ15(z, sinX);
+        int32_t tempZ = FixedMath::mulQ15(y, sinX) + FixedMath::mulQ15(z, cosX);
+        y = tempY;
+        z = tempZ;
+
+        // Rotation of the y-axis
+        int32_t tempX = FixedMath::mulQ15(x, cosY) + FixedMath::mulQ15(z, sinY);
+        z = -FixedMath::mulQ15(x, sinY) + FixedMath::mulQ15(z, cosY);
+        x = tempX;
+
+        // Perpective projection: x * distance / (distance - z), the depth in half pixels for the reciprocal table
+        const int32_t DISTANCE = 50; // Distance from the camera
+        const int32_t projectionFactor = FixedMath::reciprocal(2 * DISTANCE - ((z + 64) >> 7));
+        projectedVertices[i][0] = ((((x * projectionFactor) >> 16) * 2 * DISTANCE) >> 8) + CENTER_X;
+        projectedVertices[i][1] = ((((y * projectionFactor) >> 16) * 2 * DISTANCE) >> 8) + CENTER_Y;
+    }
+
+    // Draw the edges of the cube
+    for (int i = 0; i < 12; i++)
+    {
+        int start = cubeEdges[i][0];
+        int end = cubeEdges[i][1];
+        display->display->drawLine(
+            projectedVertices[start][0], projectedVertices[start][1],
+            projectedVertices[end][0], projectedVertices[end][1], WHITE);
+    }
+
+    display->displayBuff(); // Update the display with the rendered content
+
+    // Update now the angles for the next frame
+    _angleX += 521; // 0.05 rad
+    _angleY += 313; // 0.03 rad
+}
+
+/**
+ * @brief Perspective projection of a star: x * 100 / z, with the center of the screen as origin.
+ *
+ * @param star the star
+ * @param width width of the screen
+ * @param height height of the screen
+ * @param screenX returns the X position on the screen
+ * @param screenY returns the Y position on the screen
+ * @return true if the star is visible
+ */
+bool StarfieldScreensaver::project(const Star &star, int16_t width, int16_t height, int16_t &screenX, int16_t &screenY)
+{
+    const int32_t projectionFactor = FixedMath::reciprocal(star.z) * 100;
+    screenX = ((star.x * projectionFactor) >> 16) + width / 2;
+    screenY = ((star.y * projectionFactor) >> 16) + height / 2;
+    return screenX >= 0 && screenX < width && screenY >= 0 && screenY < height;
+}
+
+void StarfieldScreensaver::drawWidget(i2cDisplay *display)
+{
+    const unsigned long UPDATE_INTERVAL = map(_intensity, 1, 10, 100, 20); // Speed of the screensaver
+    const uint16_t SCREEN_WIDTH = display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = display->GetDisplayHeight();
+    const int STAR_COUNT = _intensity * 10;
+
+    // Initialization
+    if (_stars == nullptr)
+    {
+        _stars = static_cast<Star *>(ScreensaverMemory::acquire(STAR_COUNT * sizeof(Star)));
+        if (_stars == nullptr) return; // Out of memory
+        for (int i = 0; i < STAR_COUNT; i++)
+        {
+            _stars[i] = {static_cast<int8_t>(displayRandom.range(-100, 100)), static_cast<int8_t>(displayRandom.range(-100, 100)), static_cast<int8_t>(displayRandom.range(1, 100))};
+        }
+    }
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate < UPDATE_INTERVAL)
+    {
+        return; // Wait for the next frame
+    }
+    _lastUpdate = currentTime;
+
+    // Erase the stars at the old positions, or everything if someone else has drawn in the meantime
+    int16_t screenX, screenY;
+    if (display->claim(this))
+    {
+        display->display->clearDisplay();
+        display->markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+    else
+    {
+        for (int i = 0; i < STAR_COUNT; i++)
+        {
+            if (project(_stars[i], SCREEN_WIDTH, SCREEN_HEIGHT, screenX, screenY))
+            {
+                display->display->drawPixel(screenX, screenY, BLACK);
+                display->markDirtyPixel(screenX, screenY);
+            }
+        }
+    }
+
+    // Update and draw the stars
+    for (int i = 0; i < STAR_COUNT; i++)
+    {
+        // Update position
+        _stars[i].z -= 2; // Move outward
+        if (_stars[i].z <= 0)
+        {
+            _stars[i].z = 100;
+            _stars[i].x = displayRandom.range(-100, 100);
+            _stars[i].y = displayRandom.range(-100, 100);
+        }
+
+        // Draw the star if it is visible
+        if (project(_stars[i], SCREEN_WIDTH, SCREEN_HEIGHT, screenX, screenY))
+        {
+            display->display->drawPixel(screenX, screenY, WHITE);
+            display->markDirtyPixel(screenX, screenY);
+        }
+    }
+
+    // Update Display
+    display->displayDirty();
+}
+
+/**
+ * @brief Calculate the next generation of the Game of Life on a torus. The cells of a column are the bits of one
+ *        word, so the rows above and below are simple rotations and the 8 neighbours of all cells in a column are
+ *        added at once with bit-sliced adders (SWAR). The sum of each column and its vertical neighbours is reused
+ *        by the two adjacent columns. The cells are updated in place and written into the framebuffer as pages.
+ *
+ * @param cells one word per column, bit 0 is the top row
+ * @param width number of columns
+ * @param height number of rows (1..64)
+ * @param buffer the framebuffer in the SSD1306 page layout with width columns
+ */
+void LifeScreensaver::nextGeneration(uint64_t *cells, uint8_t width, uint8_t height, uint8_t *buffer)
+{
+    const uint64_t mask = (height >= 64) ? ~(uint64_t)0 : (((uint64_t)1 << height) - 1);
+    const uint8_t pages = (height + 7) / 8;
+
+    auto rowBelow = [mask, height](uint64_t c) { return ((c >> 1) | (c << (height - 1))) & mask; }; // Row below moved up
+    auto rowAbove = [mask, height](uint64_t c) { return ((c << 1) | (c >> (height - 1))) & mask; }; // Row above moved down
+
+    // Sum of a column with its upper and lower neighbour as 2 bit number per row: bit 0 in s0, bit 1 in s1
+    auto columnSum = [&](uint64_t c, uint64_t &s0, uint64_t &s1) {
+        const uint64_t up = rowBelow(c), dn = rowAbove(c);
+        s0 = c ^ up ^ dn;
+        s1 = (c & up) | (c & dn) | (up & dn);
+    };
+
+    uint64_t l0, l1, m0, m1, r0, r1; // Sums of the left, own and right column
+    const uint64_t first = cells[0]; // Old state of column 0, needed again as right neighbour of the last column
+    columnSum(cells[width - 1], l0, l1);
+    columnSum(first, m0, m1);
+
+    for (uint8_t x = 0; x < width; x++)
+    {
+        const uint64_t cell = cells[x];
+        columnSum((x + 1 < width) ? cells[x + 1] : first, r0, r1);
+
+        // Own column: only the cells above and below are neighbours
+        const uint64_t up = rowBelow(cell), dn = rowAbove(cell);
+        const uint64_t n0 = up ^ dn, n1 = up & dn;
+
+        // Add the three 2 bit numbers to the sum bits 0, 1 and 2 (8 neighbours overflow to 0, which is dead as well)
+        const uint64_t s0 = l0 ^ n0 ^ r0;
+        const uint64_t carry = (l0 & n0) | (l0 & r0) | (n0 & r0);
+        const uint64_t u = l1 ^ n1, v = l1 & n1;
+        const uint64_t w = r1 ^ carry, z = r1 & carry;
+        const uint64_t s1 = u ^ w;
+        const uint64_t s2 = v ^ z ^ (u & w);
+
+        const uint64_t next = s1 & ~s2 & (s0 | cell) & mask; // 3 neighbours, or 2 neighbours and alive
+        cells[x] = next;
+        for (uint8_t page = 0; page < pages; page++)
+        {
+            buffer[page * width + x] = (uint8_t)(next >> (page * 8));
+        }
+
+        l0 = m0, l1 = m1;
+        m0 = r0, m1 = r1;
+    }
+}
+
+/**
+ * @brief Show Conway's Game of Life. The cells wrap around the edges of the display.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void LifeScreensaver::drawWidget(i2cDisplay *display)
+{
+    const unsigned long UPDATE_INTERVAL = 100; // Speed of the generation
+    const uint8_t GRID_WIDTH = display->GetDisplayWidth();
+    const uint8_t GRID_HEIGHT = MIN(display->GetDisplayHeight(), 64); // One word per column
+
+    unsigned long currentTime = millis();
+    if (currentTime - _lastUpdate < UPDATE_INTERVAL)
+    {
+        return; // Wait for the next frame
+    }
+    _lastUpdate = currentTime;
+
+    // Initialize cells
+    if (_cells == nullptr)
+    {
+        _cells = static_cast<uint64_t *>(ScreensaverMemory::acquire(GRID_WIDTH * sizeof(uint64_t)));
+        if (_cells == nullptr) return; // Out of memory
+        for (uint8_t x = 0; x < GRID_WIDTH; x++)
+        {
+            _cells[x] = 0;
+            for (uint8_t y = 0; y < GRID_HEIGHT; y += 16)
+            {
+                _cells[x] |= (uint64_t)(displayRandom.next() >> 16) << y; // Randomly alive/dead cells
+            }
+        }
+    }
+
+    display->display->clearDisplay();
+    nextGeneration(_cells, GRID_WIDTH, GRID_HEIGHT, display->display->getBuffer());
+    display->displayBuff(); // Update the display
+}
+
+/**
+ * @brief Draw the decoded logo scaled and centered on the display (nearest neighbour).
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param percent the size of the logo in percent (1..100)
+ */
+void TeamIntroWidget::drawLogo(i2cDisplay *display, uint8_t percent)
+{
+    const int16_t width = (logo_OpenKNX_WIDTH * percent) / 100;
+    const int16_t height = (logo_OpenKNX_HEIGHT * percent) / 100;
+    const int16_t x0 = (display->GetDisplayWidth() - width) / 2;
+    const int16_t y0 = (display->GetDisplayHeight() - height) / 2;
+
+    display->display->clearDisplay();
+    for (int16_t y = 0; y < height; y++)
+    {
+        const int16_t srcY = (y * 100) / percent;
+        const uint8_t *srcPage = _logo + (srcY / 8) * logo_OpenKNX_WIDTH;
+        const uint8_t srcMask = 1 << (srcY & 7);
+        for (int16_t x = 0; x < width; x++)
+        {
+            if (srcPage[(x * 100) / percent] & srcMask) display->display->drawPixel(x0 + x, y0 + y, WHITE);
+        }
+    }
+    display->displayBuff();
+}
+
+void TeamIntroWidget::drawWidget(i2cDisplay *display)
+{
+    const uint16_t SCREEN_WIDTH = display->GetDisplayWidth();
+    const uint16_t SCREEN_HEIGHT = display->GetDisplayHeight();
+    const uint16_t LOGO_DISPLAY_TIME = 2000;  // Time to display the logo in full size (ms)
+    const uint16_t ZOOM_OUT_SPEED = 50;       // Delay between zoom-out steps (ms)
+    const uint16_t SCROLL_SPEED = 20;         // Speed of scrolling (ms)
+    const uint16_t FONT_SIZE = 1;             // Base font size
+    const uint8_t MAX_FONT_SIZE = 2;          // Maximum font size
+    const uint8_t END_TEXT_MAX_FONT_SIZE = 1; // Smaller end text size
+
+    unsigned long currentTime = millis();
+
+    switch (_state)
+    {
+        case 0: // Display the logo in full size
+            if (_logo == nullptr)
+            {
+                // Decode the compressed logo once. The zoom-out scales it from there
+                _logo = static_cast<uint8_t *>(ScreensaverMemory::acquire(logo_OpenKNX_WIDTH * ((logo_OpenKNX_HEIGHT + 7) / 8)));
+                if (_logo == nullptr) return; // Out of memory
+                RleDecoder decoder;
+                decoder.begin({logo_OpenKNX_rle, sizeof(logo_OpenKNX_rle), logo_OpenKNX_WIDTH, logo_OpenKNX_HEIGHT},
+                              _logo, logo_OpenKNX_WIDTH, logo_OpenKNX_HEIGHT, 0, 0);
+                decoder.decodeAll();
+            }
+
+            if (currentTime - _lastUpdate >= LOGO_DISPLAY_TIME)
+            {
+                _lastUpdate = currentTime;
+                _step = 100; // Start zoom-out at 100%
+                _state = 1;
+            }
+            else
+            {
+                drawLogo(display, 100);
+            }
+            break;
+
+        case 1: // Zoom out the logo
+            if (currentTime - _lastUpdate >= ZOOM_OUT_SPEED)
+            {
+                _lastUpdate = currentTime;
+
+                if (_step >= 10)
+                {
+                    drawLogo(display, _step);
+                    _step -= 5;
+                }
+                else
+                {
+                    ScreensaverMemory::release(_logo); // The logo is not needed anymore
+                    _logo = nullptr;
+                    _step = SCREEN_HEIGHT; // Set scroll start
+                    _state = 2;            // Move to the next state
+                }
+            }
+            break;
+
+        case 2: // Scroll names from the bottom
+            if (_currentNameIndex < DEVELOPER_COUNT)
+            {
+                if (currentTime - _lastUpdate >= SCROLL_SPEED)
+                {
+                    _lastUpdate = currentTime;
+
+                    if (_step > 0)
+                    {
+                        display->display->clearDisplay();
+                        FastText::print(display->display, SCREEN_WIDTH / 2 - (strlen(DEVELOPER_NAMES[_currentNameIndex]) * 3), _step,
+                                        DEVELOPER_NAMES[_currentNameIndex], SSD1306_WHITE, SSD1306_WHITE, FONT_SIZE);
+                        display->displayBuff();
+                        _step--;
+                    }
+                    else
+                    {
+                        _state = 3; // Zoom effect for names
+                        _step = FONT_SIZE;
+                        _lastUpdate = currentTime; // Prevent immediate transition
+                    }
+                }
+            }
+            else
+            {
+                _step = 1;
+                _state = 5; // Move to end text display
+            }
+            break;
+
+        case 3: // Zoom effect for the current name
+            if (currentTime - _lastUpdate >= ZOOM_OUT_SPEED)
+            {
+                _lastUpdate = currentTime;
+
+                if (_step <= MAX_FONT_SIZE)
+                {
+                    display->display->clearDisplay();
+                    FastText::print(display->display, SCREEN_WIDTH / 2 - (strlen(DEVELOPER_NAMES[_currentNameIndex]) * 3 * _step), SCREEN_HEIGHT / 2 - (6 * _step),
+                                    DEVELOPER_NAMES[_currentNameIndex], SSD1306_WHITE, SSD1306_WHITE, _step);
+                    display->displayBuff();
+                    _step++;
+                }
+                else
+                {
+                    _state = 4;  // Move to fade-out
+                    _step = 255; // Start value for fade-out
+                    _lastUpdate = currentTime;
+                }
+            }
+            break;
+
+        case 4: // Fade-out for the current name
+            if (currentTime - _lastUpdate >= ZOOM_OUT_SPEED)
+            {
+                _lastUpdate = currentTime;
+
+                if (_step > 0)
+                {
+                    display->display->clearDisplay();
+                    FastText::print(display->display, SCREEN_WIDTH / 2 - (strlen(DEVELOPER_NAMES[_currentNameIndex]) * 3 * MAX_FONT_SIZE), SCREEN_HEIGHT / 2 - (6 * MAX_FONT_SIZE),
+                                    DEVELOPER_NAMES[_currentNameIndex], SSD1306_WHITE, SSD1306_WHITE, MAX_FONT_SIZE);
+                    display->displayBuff();
+                    _step -= 15;
+                }
+                else
+                {
+                    _step = SCREEN_HEIGHT; // Reset for the next name
+                    _currentNameIndex++;
+                    _state = 2; // Back to scrolling
+                }
+            }
+            break;
+
+        case 5: // Display end text with slow zoom
+            if (currentTime - _lastUpdate >= 300)
+            {
+                _lastUpdate = currentTime;
+
+                if (_step <= END_TEXT_MAX_FONT_SIZE)
+                { // Smaller maximum size
+                    display->display->clearDisplay();
+                    FastText::print(display->display, SCREEN_WIDTH / 2 - (strlen(END_TEXT) * 3 * _step), SCREEN_HEIGHT / 2 - (6 * _step),
+                                    END_TEXT, SSD1306_WHITE, SSD1306_WHITE, _step);
+                    display->displayBuff();
+                    _step += 0.5; // Finer zoom
+                }
+                else
+                {
+                    _state = 6; // Final state, show end text permanently
+                }
+            }
+            break;
+
+        case 6: // End text remains visible
+            display->display->clearDisplay();
+            FastText::print(display->display, SCREEN_WIDTH / 2 - (strlen(END_TEXT) * 9), SCREEN_HEIGHT / 2 - 9,
+                            END_TEXT, SSD1306_WHITE, SSD1306_WHITE, 3);
+            display->displayBuff();
+            break;
+    }
+}
+
+#endif // MATRIX_SCREENSAVER
@@ -0,0 +1,218 @@
+#pragma once
+/**
+ * @file        Screensavers.h
+ * @brief       Screensaver widgets and the OpenKNX team intro
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ */
+#include "Widget.h"
+#include "RleBitmap.h"
+
+#ifdef MATRIX_SCREENSAVER
+
+// Matrix screensaver settings
+#define COLUMN_WIDTH 8 // Width of a column in pixels
+#define FALL_SPEED 50  // Falling speed in milliseconds
+#define MAX_DROPS 5    // Maximum number of falling characters per column
+
+/**
+ * Heap memory for the state of the screensavers (drops, stars, cells, ...). This is no reserved pool: the blocks are
+ * taken with calloc() when the screensaver is drawn for the first time, not when it is added (e.g. with
+ * "ddc <saver> s"), and freed by its destructor, i.e. by DeviceDisplay::removeWidget(). So the RAM is only used while
+ * a screensaver was shown and is still in the widget queue, and every instance starts with its own fresh state.
+ * used() and peak() only count these blocks, so they stay 0 until a screensaver was drawn.
+ */
+class ScreensaverMemory
+{
+  public:
+    static void *acquire(uint16_t size);            // Get a zeroed block of size bytes (8-byte aligned). nullptr if out of memory
+    static void release(void *block);               // Return a block. nullptr is ignored
+    static inline uint32_t used() { return _used; } // Bytes currently used by screensaver states
+    static inline uint32_t peak() { return _peak; } // Maximum of used() since startup
+
+  private:
+    union Header // In front of every block
+    {
+        uint32_t size;  // Size of the block incl. the header
+        uint64_t align; // Keeps the block 8-byte aligned
+    };
+
+    static uint32_t _used; // Bytes currently used
+    static uint32_t _peak; // Maximum bytes used
+};
+
+class MatrixScreensaver : public Widget
+{
+  public:
+    MatrixScreensaver() : Widget(DisplayMode::SCREEN_SAVER) {}     // Constructor
+    ~MatrixScreensaver() { ScreensaverMemory::release(_dropPos); } // Destructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the matrix screensaver with falling characters
+
+  private:
+    uint8_t *_dropPos = nullptr; // Y position of the drops, MAX_DROPS per column. From the ScreensaverMemory
+    ulong _lastUpdate = 0;       // Last time the screensaver was updated
+};
+
+class MatrixPixelScreensaver : public Widget
+{
+  public:
+    MatrixPixelScreensaver(uint8_t intensity = 10) : Widget(DisplayMode::SCREEN_SAVER_MATRIX), _intensity(intensity) {} // Constructor
+    ~MatrixPixelScreensaver() { ScreensaverMemory::release(_columns); }                                                 // Destructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the matrix screensaver with falling pixels
+
+  private:
+    struct Column
+    {
+        int8_t head;    // Position of the head
+        uint8_t length; // Length of the "tail"
+    };
+
+    static uint8_t tailPixels(uint8_t length); // Number of drawn pixels of a tail
+
+    Column *_columns = nullptr; // One per pixel column. From the ScreensaverMemory
+    ulong _lastUpdate = 0;      // Last time the screensaver was updated
+    uint8_t _intensity;         // Speed of the screensaver (1..10)
+};
+
+class ClockScreensaver : public Widget
+{
+  public:
+    ClockScreensaver(bool rounded = false) : Widget(DisplayMode::SCREEN_SAVER_CLOCK), _rounded(rounded) {} // Constructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the analog clock screensaver
+
+  private:
+    static const uint8_t DIGIT_GLYPHS = 11; // Cached glyphs: '0'..'9' and ':'
+
+    void drawDigital(i2cDisplay *display, const char *timeString); // Draw the changed characters of the digital clock
+
+    static uint8_t _digitGlyphs[DIGIT_GLYPHS][FastText::GLYPH_WIDTH]; // Page bytes of the digits, shared by all clocks
+    static bool _digitsCached;                                        // True if _digitGlyphs is filled
+
+    ulong _lastUpdate = 0;    // Last time the screensaver was updated
+    char _shownTime[9] = {0}; // Time currently shown by the digital clock, "HH:MM:SS"
+    bool _rounded;            // Draw a round clock face
+};
+
+class PongScreensaver : public Widget
+{
+  public:
+    PongScreensaver() : Widget(DisplayMode::SCREEN_SAVER_PONG) {} // Constructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the pong screensaver
+
+  private:
+    ulong _lastUpdate = 0;     // Last time the screensaver was updated
+    bool _initialized = false; // Paddles and ball are placed on the first draw
+    int16_t _paddleLeftY;      // Y position of the left paddle
+    int16_t _paddleRightY;     // Y position of the right paddle
+    int16_t _ballX;            // Position of the ball
+    int16_t _ballY;            // Position of the ball
+    int8_t _ballSpeedX = -1;   // Ball speed X (horizontal)
+    int8_t _ballSpeedY = 1;    // Ball speed Y (vertical)
+};
+
+class RainScreensaver : public Widget
+{
+  public:
+    RainScreensaver(uint8_t intensity = 10) : Widget(DisplayMode::SCREEN_SAVER_RAIN), _intensity(intensity) {} // Constructor
+    ~RainScreensaver() { ScreensaverMemory::release(_drops); }                                                 // Destructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the rainfall screensaver
+
+  private:
+    struct Drop
+    {
+        uint8_t x, y; // Position of the drop
+    };
+
+    Drop *_drops = nullptr; // The drops. From the ScreensaverMemory
+    ulong _lastUpdate = 0;  // Last time the screensaver was updated
+    uint8_t _intensity;     // Number of drops (1..10)
+};
+
+class StarfieldScreensaver : public Widget
+{
+  public:
+    StarfieldScreensaver(uint8_t intensity = 8) : Widget(DisplayMode::SCREEN_SAVER_STARFIELD), _intensity(intensity) {} // Constructor
+    ~StarfieldScreensaver() { ScreensaverMemory::release(_stars); }                                                     // Destructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the starfield screensaver
+
+  private:
+    struct Star
+    {
+        int8_t x, y, z; // Position. z is the depth (1..100)
+    };
+
+    static bool project(const Star &star, int16_t width, int16_t height, int16_t &screenX, int16_t &screenY); // Screen position. False if not visible
+
+    Star *_stars = nullptr; // 10 stars per intensity step. From the ScreensaverMemory
+    ulong _lastUpdate = 0;  // Last time the screensaver was updated
+    uint8_t _intensity;     // Speed and number of stars (1..10)
+};
+
+class CubeScreensaver : public Widget
+{
+  public:
+    CubeScreensaver() : Widget(DisplayMode::SCREEN_SAVER_3DCUBE) {} // Constructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the rotating 3D cube screensaver
+
+  private:
+    ulong _lastUpdate = 0; // Last time the screensaver was updated
+    uint16_t _angleX = 0;  // Rotation angle in FixedMath units << 6 (wraps around at a full circle)
+    uint16_t _angleY = 0;  // Rotation angle in FixedMath units << 6
+};
+
+class LifeScreensaver : public Widget
+{
+  public:
+    LifeScreensaver() : Widget(DisplayMode::SCREEN_SAVER_LIFE) {} // Constructor
+    ~LifeScreensaver() { ScreensaverMemory::release(_cells); }    // Destructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show Conway's Game of Life
+
+  private:
+    static void nextGeneration(uint64_t *cells, uint8_t width, uint8_t height, uint8_t *buffer); // Calculate the next generation
+
+    uint64_t *_cells = nullptr; // One bit per cell, one word per column (bit 0 = top row). From the ScreensaverMemory
+    ulong _lastUpdate = 0;      // Last time the screensaver was updated
+};
+
+class TeamIntroWidget : public Widget
+{
+  public:
+    TeamIntroWidget() : Widget(DisplayMode::OPENKNX_TEAM_INTRO) {} // Constructor
+    ~TeamIntroWidget() { ScreensaverMemory::release(_logo); }      // Destructor
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Show the OpenKNX team intro
+
+  private:
+    static const char *const DEVELOPER_NAMES[]; // Names of the OpenKNX team (flash)
+    static const uint8_t DEVELOPER_COUNT;       // Number of names
+    static const char END_TEXT[];               // Text at the end of the intro
+
+    void drawLogo(i2cDisplay *display, uint8_t percent); // Draw the logo scaled to percent of its size
+
+    uint8_t *_logo = nullptr;      // Decoded logo in the page layout while it is shown. From the ScreensaverMemory
+    ulong _lastUpdate = 0;         // Last update time of the animation
+    int16_t _step = 0;             // Step within a state
+    uint8_t _state = 0;            // Current state of the animation
+    uint8_t _currentNameIndex = 0; // Current index of the names
+};
+
+#endif // MATRIX_SCREENSAVER
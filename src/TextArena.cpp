@@ -0,0 +1,167 @@
+#include "TextArena.h"
+
+TextArena textArena;
+
+TextArena::TextArena()
+{
+    for (uint8_t i = 0; i < TEXT_ARENA_MAX_HANDLES; i++)
+    {
+        _offsets[i] = UNUSED;
+    }
+}
+
+/**
+ * @brief Take a new block from the end of the arena. If there is not enough space, the arena is compacted first.
+ *
+ * @param handle the handle of the new block
+ * @param capacity bytes needed for the text incl. the null termination. Will be aligned
+ * @return uint16_t offset of the block, or UNUSED if the arena is full
+ */
+uint16_t TextArena::allocate(Handle handle, uint16_t capacity)
+{
+    capacity = (capacity + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    const uint16_t blockSize = sizeof(Block) + capacity;
+
+    if (_top + blockSize > sizeof(_buffer))
+    {
+        compact();
+        if (_top + blockSize > sizeof(_buffer)) return UNUSED;
+    }
+
+    const uint16_t offset = _top;
+    block(offset)->capacity = capacity;
+    block(offset)->handle = handle;
+    _top += blockSize;
+    return offset;
+}
+
+/**
+ * @brief Store a text in the arena. If the handle is NONE, a new handle is assigned. If the text does not fit
+ *        into the arena, it is shortened to the space left. The text may be a text of the arena itself, it is
+ *        found again if the arena is compacted.
+ *
+ * @param handle the handle of the text. Updated if a new handle is assigned or the text is empty
+ * @param text the text. Does not need to be null-terminated
+ * @param len length of the text
+ * @return uint16_t the length of the stored text
+ */
+uint16_t TextArena::set(Handle &handle, const char *text, uint16_t len)
+{
+    if (len == 0)
+    {
+        release(handle);
+        return 0;
+    }
+
+    // A text in the arena (e.g. the text of another line) is moved by compact(). Remember its block to find it again
+    Handle source = NONE;
+    uint16_t sourceDelta = 0;
+    if (text >= reinterpret_cast<const char *>(_buffer) && text < reinterpret_cast<const char *>(_buffer + _top))
+    {
+        const uint16_t pos = text - reinterpret_cast<const char *>(_buffer);
+        for (uint16_t offset = 0; offset < _top; offset += sizeof(Block) + block(offset)->capacity)
+        {
+            if (pos < offset + sizeof(Block) + block(offset)->capacity)
+            {
+                source = block(offset)->handle;
+                sourceDelta = pos - offset;
+                break;
+            }
+        }
+    }
+
+    if (handle != NONE && block(_offsets[handle - 1])->capacity < len + 1) // Does not fit into the current block
+    {
+        release(handle);
+    }
+
+    if (handle == NONE) // Find a free handle and allocate a block
+    {
+        for (uint8_t i = 0; i < TEXT_ARENA_MAX_HANDLES; i++)
+        {
+            if (_offsets[i] == UNUSED)
+            {
+                handle = i + 1;
+                break;
+            }
+        }
+        if (handle == NONE) return 0; // No handle left
+
+        uint16_t offset = allocate(handle, len + 1);
+        if (offset == UNUSED) // Full: use the space left
+        {
+            const uint16_t left = sizeof(_buffer) - _top;
+            len = (left > sizeof(Block) + ALIGNMENT) ? ((left - sizeof(Block)) & ~(ALIGNMENT - 1)) - 1 : 0;
+            offset = (len > 0) ? allocate(handle, len + 1) : UNUSED;
+        }
+        if (offset == UNUSED)
+        {
+            handle = NONE;
+            return 0;
+        }
+        _offsets[handle - 1] = offset;
+    }
+
+    if (source != NONE && _offsets[source - 1] != UNUSED) text = reinterpret_cast<const char *>(_buffer + _offsets[source - 1] + sourceDelta);
+
+    char *dst = reinterpret_cast<char *>(_buffer + _offsets[handle - 1] + sizeof(Block));
+    memmove(dst, text, len); // The source may be a part of the same text
+    dst[len] = '\0';
+    return len;
+}
+
+/**
+ * @brief Free the text of a handle. The block becomes a hole until the next compact().
+ *
+ * @param handle the handle. Set to NONE
+ */
+void TextArena::release(Handle &handle)
+{
+    if (handle == NONE) return;
+
+    Block *b = block(_offsets[handle - 1]);
+    b->handle = NONE;
+    _holes += sizeof(Block) + b->capacity;
+    _offsets[handle - 1] = UNUSED;
+    handle = NONE;
+}
+
+/**
+ * @brief Get the text of a handle.
+ *
+ * @param handle the handle
+ * @return const char* the null-terminated text. Only valid until the next set() or compact()
+ */
+const char *TextArena::get(Handle handle) const
+{
+    if (handle == NONE) return "";
+    return reinterpret_cast<const char *>(_buffer + _offsets[handle - 1] + sizeof(Block));
+}
+
+/**
+ * @brief Move all used blocks to the start of the arena, so the holes of freed or moved texts are
+ *        available again at the end.
+ */
+void TextArena::compact()
+{
+    if (_holes == 0) return;
+
+    uint16_t write = 0;
+    for (uint16_t read = 0; read < _top;)
+    {
+        const Block *b = block(read);
+        const uint16_t blockSize = sizeof(Block) + b->capacity;
+        if (b->handle != NONE)
+        {
+            if (write != read)
+            {
+                _offsets[b->handle - 1] = write;
+                memmove(_buffer + write, _buffer + read, blockSize);
+            }
+            write += blockSize;
+        }
+        read += blockSize;
+    }
+    _top = write;
+    _holes = 0;
+}
@@ -0,0 +1,64 @@
+#pragma once
+/**
+ * @file        TextArena.h
+ * @brief       Shared storage for the texts of all widgets
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Instead of a fixed buffer per text line, all texts are stored in one module-wide arena and the lines only hold a
+ * handle. The RAM used for texts scales with the length of the texts actually shown.
+ *
+ * Every text is a block in the arena: a small header (capacity and handle) followed by the null-terminated text.
+ * New blocks are taken from the end (bump allocation). A text which still fits into its block is overwritten in
+ * place, otherwise a new block is allocated and the old one becomes a hole. compact() moves all used blocks
+ * together and is called when the arena is full and when a widget is removed.
+ *
+ * The pointer returned by get() is only valid until the next set() or compact().
+ */
+#include <Arduino.h>
+
+#define TEXT_ARENA_SIZE 2048      // Size of the arena in bytes for all texts of all widgets
+#define TEXT_ARENA_MAX_HANDLES 96 // Maximum number of texts in the arena. Max. 255
+
+class TextArena
+{
+  public:
+    typedef uint8_t Handle;            // Handle of a text. NONE is the empty text
+    static const Handle NONE = 0;      // Handle of the empty text, no memory is used
+    static const uint8_t ALIGNMENT = 4; // Blocks are aligned to 4 bytes
+
+    TextArena();
+
+    uint16_t set(Handle &handle, const char *text, uint16_t len); // Store the text. Returns the stored length, less than len if the arena is full
+    void release(Handle &handle);                                 // Free the text and set the handle to NONE
+    const char *get(Handle handle) const;                         // Get the text. "" for NONE
+    void compact();                                               // Move all used blocks together
+
+    inline uint16_t used() const { return _top - _holes; } // Bytes used by texts incl. the block headers
+    inline uint16_t footprint(Handle handle) const { return (handle == NONE) ? 0 : sizeof(Block) + block(_offsets[handle - 1])->capacity; } // Bytes used by a text incl. its block header
+    static inline uint16_t blockSize(uint16_t len) { return (len == 0) ? 0 : sizeof(Block) + ((len + ALIGNMENT) & ~(ALIGNMENT - 1)); } // Bytes a new text of len characters will use
+    inline uint16_t size() const { return sizeof(_buffer); } // Size of the arena in bytes
+
+  private:
+    struct Block
+    {
+        uint16_t capacity; // Bytes for the text incl. the null termination
+        Handle handle;     // Handle of the text. NONE if the block is free
+        uint8_t reserved;  // Keeps the text aligned
+    };
+
+    static const uint16_t UNUSED = 0xFFFF; // Offset of an unused handle
+
+    inline Block *block(uint16_t offset) { return reinterpret_cast<Block *>(_buffer + offset); }
+    inline const Block *block(uint16_t offset) const { return reinterpret_cast<const Block *>(_buffer + offset); }
+    uint16_t allocate(Handle handle, uint16_t capacity); // Take a new block from the end. Returns UNUSED if the arena is full
+
+    alignas(ALIGNMENT) uint8_t _buffer[TEXT_ARENA_SIZE]; // The texts
+    uint16_t _offsets[TEXT_ARENA_MAX_HANDLES];           // Offset of the block of each handle
+    uint16_t _top = 0;                                   // End of the last block
+    uint16_t _holes = 0;                                 // Bytes of the free blocks below _top
+};
+
+extern TextArena textArena; // Texts of all widgets
@@ -0,0 +1,52 @@
+#include "TextFormat.h"
+
+/**
+ * @brief Format a fixed-point value. The result is the same as printing (float)value / divisor with the given
+ *        number of decimals, but without float arithmetic.
+ *
+ * @param dst the buffer for the text
+ * @param size size of the buffer
+ * @param value the value
+ * @param divisor the divisor (> 0). divisor * 10^decimals must fit into 32 bits
+ * @param decimals number of decimals (0..9)
+ * @return char* dst
+ */
+char *TextFormat::fixed(char *dst, size_t size, int32_t value, uint32_t divisor, uint8_t decimals)
+{
+    uint32_t scale = 1;
+    for (uint8_t i = 0; i < decimals; i++)
+    {
+        scale *= 10;
+    }
+
+    const bool negative = (value < 0);
+    const uint32_t magnitude = negative ? -(uint32_t)value : (uint32_t)value;
+    uint32_t whole = magnitude / divisor;
+    uint32_t fraction = ((magnitude % divisor) * scale + divisor / 2) / divisor; // Rounded decimals
+    if (fraction >= scale)                                                      // Rounded up to the next whole number
+    {
+        whole++;
+        fraction -= scale;
+    }
+
+    if (decimals == 0)
+        snprintf(dst, size, "%s%lu", negative ? "-" : "", (unsigned long)whole);
+    else
+        snprintf(dst, size, "%s%lu.%0*lu", negative ? "-" : "", (unsigned long)whole, decimals, (unsigned long)fraction);
+    return dst;
+}
+
+/**
+ * @brief Format an uptime.
+ *
+ * @param dst the buffer for the text
+ * @param size size of the buffer
+ * @param seconds the uptime in seconds, e.g. uptime()
+ * @return char* dst
+ */
+char *TextFormat::uptime(char *dst, size_t size, uint32_t seconds)
+{
+    snprintf(dst, size, "%lud %02u:%02u:%02u", (unsigned long)(seconds / 86400),
+             (unsigned)(seconds / 3600 % 24), (unsigned)(seconds / 60 % 60), (unsigned)(seconds % 60));
+    return dst;
+}
@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * @file        TextFormat.h
+ * @brief       Allocation-free number formatting for the text lines of the widgets
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ *
+ * Building a line with String("Free mem: " + String((float)freeMemory() / 1024) + " KiB") allocates several heap
+ * strings and uses the soft-float conversion of the RP2040. The helpers here write into a buffer of the caller
+ * with integer arithmetic only and return it, so they can be passed straight to TextWidget::SetDynamicTextLinef():
+ *
+ *   char mem[12];
+ *   widget->SetDynamicTextLinef(5, "Free mem: %s KiB", TextFormat::fixed(mem, sizeof(mem), freeMemory(), 1024, 2));
+ */
+#include <Arduino.h>
+
+class TextFormat
+{
+  public:
+    // value / divisor with the given number of decimals (rounded). E.g. fixed(buf, size, 1536, 1024, 2) = "1.50"
+    static char *fixed(char *dst, size_t size, int32_t value, uint32_t divisor, uint8_t decimals);
+
+    // Uptime in the format of the OpenKNX logger: "<days>d hh:mm:ss"
+    static char *uptime(char *dst, size_t size, uint32_t seconds);
+};
@@ -0,0 +1,630 @@
+#include "TextWidget.h"
+#include <stdarg.h>
+
+/**
+ * @brief Construct a new TextWidget object with the default settings of the text lines.
+ */
+TextWidget::TextWidget()
+    : Widget(DisplayMode::DYNAMIC_TEXT)
+{
+    // Initialize some default values
+    InitDynamicTextLines();
+}
+
+/**
+ * @brief Destroy the TextWidget object. The texts are freed and the textArena is compacted.
+ */
+TextWidget::~TextWidget()
+{
+    for (int i = 0; i < MAX_TEXT_LINES; ++i)
+    {
+        textArena.release(textLines[i]._text);
+    }
+    textArena.compact();
+}
+
+/**
+ * @brief Draw the dynamic text lines.
+ *
+ * @param display pointer to the i2cDisplay object.
+ */
+void TextWidget::drawWidget(i2cDisplay *display)
+{
+    UpdateDynamicTextLines(display);
+}
+
+/**
+ * @brief Empty all text lines. This function will empty all text lines.
+ */
+void TextWidget::EmptyLines()
+{
+    for (int i = 0; i < MAX_TEXT_LINES; ++i)
+    {
+        setLineText(&textLines[i], ""); // Empty the text
+    }
+}
+
+/**
+ * @brief Store the text of a line in the textArena and update its length and hash. If the text is different
+ *        from the previous one, the hash is updated and the scroll position is reset. An unchanged text is not
+ *        written again if it is stored completely or was shortened to the budget of the widget. A text which was
+ *        shortened because the textArena was full is stored again, so it recovers when space is freed.
+ *        The texts of one widget use at most TEXT_WIDGET_ARENA_BUDGET bytes, so a widget with long lines cannot
+ *        take the arena from the other ones.
+ *
+ * @param sText the line
+ * @param text the new text. Cut after MAX_CHARS_PER_LINE_SCROLL characters
+ * @return true if the text has changed
+ */
+bool TextWidget::setLineText(lcdText *sText, const char *text)
+{
+    const uint16_t len = strnlen(text, MAX_CHARS_PER_LINE_SCROLL);
+    const uint32_t hash = DisplayList::hash(text, len);
+    const bool sameText = (len == sText->_requestedLen && hash == sText->_textHash);
+    if (sameText && (sText->_textLen == len || sText->_cutByBudget)) return false; // Nothing more can be stored
+
+    // Space left of the budget of this widget. Every text needs its null termination
+    uint16_t used = 0;
+    for (uint8_t i = 0; i < MAX_TEXT_LINES; i++)
+    {
+        if (&textLines[i] != sText && textLines[i]._textLen != 0) used += textLines[i]._textLen + 1;
+    }
+    const uint16_t budget = (used + 1 < TEXT_WIDGET_ARENA_BUDGET) ? TEXT_WIDGET_ARENA_BUDGET - used - 1 : 0;
+
+    const uint16_t stored = textArena.set(sText->_text, text, std::min(len, budget));
+    const bool cutByBudget = (stored < len && stored == budget);
+    if (sameText && stored == sText->_textLen) // Retried, but the textArena is still full
+    {
+        sText->_cutByBudget = cutByBudget;
+        return false;
+    }
+    if (stored != len)
+    {
+        logInfo("TextWidget", "Text shortened from %d to %d characters (%s full)", len, stored, cutByBudget ? "widget budget" : "textArena");
+    }
+    sText->_requestedLen = len;
+    sText->_textLen = stored;
+    sText->_textHash = hash;
+    sText->_cutByBudget = cutByBudget;
+    sText->scrollPos = 0; // Reset scroll position
+    return true;
+}
+
+/**
+ * @brief Set the text for a specific line in the widget. The line index is
+ * zero-based. and there is a maximum of 8 lines. The text will be copied into
+ * the line's buffer, ensuring no overflow. YOu can set the text color,
+ * background color, alignment, and text size for each line. Depending on the
+ * settings, the text can be scrolled, paused at the start, or paused at the
+ * end. The size of the text buffer is limited to 21 characters. All text lines
+ * with more than 21 characters will be displayed as scrolling text, but only if
+ * the scrollText flag is set to true. The line size depends on the display size
+ * and the text size. For a 128x64 display, the maximum number lines for 1 text
+ * size is 7, for text size 2 is 4, for text size 3 is 3, and for text size 4
+ * is 2.
+ * @param lineIndex is the index of the line to set the text for. The index is
+ * zero-based.
+ * @param text is the text to set for the line. The text will be copied into the
+ * line's buffer, ensuring no overflow.
+ * @example SerLine(0, "Updated Header Text");
+ *          SetLine(1, "Updated Line 2 Text");
+ */
+void TextWidget::SetDynamicTextLine(size_t lineIndex, const char *text)
+{
+    // Ensure the line index is within bounds
+    if (lineIndex >= MAX_TEXT_LINES)
+    {
+        return; // Do nothing if index is out of bounds
+    }
+
+    // Store the new text of the line. An unchanged text keeps the line as it is, incl. the scroll position
+    if (setLineText(&textLines[lineIndex], text))
+    {
+        textLines[lineIndex]._scrollTextPaused = false; // Unpause scroll if needed
+    }
+}
+
+/**
+ * @brief Set the text for a specific line with a printf-style format. The text is formatted on the stack, no
+ *        heap is used. Like SetDynamicTextLine(), the line is only stored again if the resulting text differs,
+ *        so a periodic refresh with unchanged values costs nothing downstream.
+ *        Use the TextFormat helpers for fixed-point numbers and the uptime instead of float formatting.
+ *
+ * @param lineIndex is the index of the line to set the text for. The index is zero-based.
+ * @param format the printf format. The text is cut after MAX_CHARS_PER_LINE_SCROLL characters
+ * @example SetDynamicTextLinef(1, "Uptime: %s", TextFormat::uptime(buf, sizeof(buf), uptime()));
+ */
+void TextWidget::SetDynamicTextLinef(size_t lineIndex, const char *format, ...)
+{
+    if (lineIndex >= MAX_TEXT_LINES) return; // Do nothing if index is out of bounds
+
+    char text[MAX_CHARS_PER_LINE_SCROLL + 1];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    SetDynamicTextLine(lineIndex, text);
+}
+
+/**
+ * @brief Bind a line to a provider callback, which writes the text of the line. The provider is called by
+ *        refreshBindings(), i.e. only while the widget is on screen and at most once per interval. A hidden widget
+ *        costs nothing, no matter how many lines are bound. The first refresh happens when the widget is shown.
+ *        Like SetDynamicTextLine(), an unchanged text is not drawn again. Binding a line again replaces the provider.
+ *
+ * @param lineIndex is the index of the line to bind. The index is zero-based.
+ * @param provider writes the null-terminated text into the buffer (MAX_CHARS_PER_LINE_SCROLL + 1 bytes)
+ * @param intervalMs refresh interval in milliseconds
+ * @example BindDynamicTextLine(1, [](char *text, size_t size) { snprintf(text, size, "Up: %lu", uptime()); });
+ */
+void TextWidget::BindDynamicTextLine(size_t lineIndex, LineProvider provider, uint32_t intervalMs)
+{
+    if (lineIndex >= MAX_TEXT_LINES || !provider) return; // Do nothing if index is out of bounds
+
+    for (LineBinding &binding : _bindings)
+    {
+        if (binding.lineIndex == lineIndex)
+        {
+            binding.provider = provider;
+            binding.interval = intervalMs;
+            binding.refreshed = false;
+            return;
+        }
+    }
+    _bindings.push_back({provider, intervalMs, 0, (uint8_t)lineIndex, false});
+}
+
+/**
+ * @brief Remove the binding of a line. The line keeps its last text.
+ *
+ * @param lineIndex is the index of the bound line. The index is zero-based.
+ */
+void TextWidget::UnbindDynamicTextLine(size_t lineIndex)
+{
+    for (auto it = _bindings.begin(); it != _bindings.end(); ++it)
+    {
+        if (it->lineIndex == lineIndex)
+        {
+            _bindings.erase(it);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Call the providers of the bound lines whose interval has elapsed and store their texts.
+ *        Called by DeviceDisplay right before the widget is drawn, so only the widget on screen is refreshed.
+ *
+ * @param now the current time in milliseconds
+ */
+void TextWidget::refreshBindings(uint32_t now)
+{
+    if (_bindings.empty()) return;
+
+    char text[MAX_CHARS_PER_LINE_SCROLL + 1];
+    for (LineBinding &binding : _bindings)
+    {
+        if (binding.refreshed && now - binding.lastRefresh < binding.interval) continue;
+
+        text[0] = '\0';
+        binding.provider(text, sizeof(text));
+        text[sizeof(text) - 1] = '\0';
+        SetDynamicTextLine(binding.lineIndex, text);
+        binding.lastRefresh = now;
+        binding.refreshed = true;
+    }
+}
+
+/**
+ * @brief  Set the text for all lines in the widget. The text will be copied
+ * into the line's buffer, ensuring no overflow.
+ *
+ * @param lines is a vector of text lines to set for the widget. The text will
+ * be copied into the line's buffer, ensuring no overflow.
+ * @example SetLines({"Header Text", "Line 1 Text", "Line 2 Text"});
+ */
+void TextWidget::SetDynamicTextLines(const std::vector<const char *> &lines)
+{
+    // Limit the number of lines to the pre-allocated textLines capacity
+    size_t lineCount = std::min(lines.size(), static_cast<size_t>(MAX_TEXT_LINES));
+
+    // Set each line's text and properties
+    for (size_t i = 0; i < lineCount; ++i)
+    {
+        setLineText(&textLines[i], lines[i]); // Store the text of the line
+    }
+
+    // Clear remaining unused text lines, if any
+    for (size_t i = lineCount; i < MAX_TEXT_LINES; ++i)
+    {
+        setLineText(&textLines[i], ""); // Empty unused line
+    }
+}
+
+/**
+ * @brief Initialize the dynamic text lines with default settings. This function
+ * is called in the constructor to set up the text lines with default values.
+ */
+void TextWidget::InitDynamicTextLines()
+{
+    for (int i = 0; i < MAX_TEXT_LINES; ++i) // Initialize all text lines with default values
+    {
+        textLines[i].scrollPos = 0;
+        textLines[i].startPosY = 0;
+        textLines[i].startPosX = 0;
+
+        if (i == 0)
+        {                                           // Setting the default values for the Header!
+            textLines[i].textColor = SSD1306_BLACK; // Set default text color for the Header
+            textLines[i].bgColor = SSD1306_WHITE;   // Set default background color for the Header
+            textLines[i].alignPos = ALIGN_CENTER;   // Set default alignment for the Header
+        }
+        else
+        {
+            textLines[i].textColor = SSD1306_WHITE; // Set default text color
+            textLines[i].bgColor = SSD1306_BLACK;   // Set default background color
+            textLines[i].alignPos = ALIGN_LEFT;     // Set default alignment
+        }
+        textLines[i].textSize = 1;
+        textLines[i].scrollText = true;
+        textLines[i].pauseAtStart = true;
+        textLines[i]._lastPauseTime = 0;
+        textLines[i]._lastScrollTime = 0;
+        textLines[i]._scrollTextPaused = false;
+        textLines[i]._textHash = DisplayList::HASH_SEED;
+        textLines[i]._textLen = 0;
+        textLines[i]._requestedLen = 0;
+        textLines[i]._cutByBudget = false;
+        textArena.release(textLines[i]._text);
+    }
+}
+
+/**
+ * @brief Update the dynamic text lines on the display. This function should be
+ * called in the loop function to update the dynamic text lines on the display.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @return true if any text lines have been updated or scrolled, false
+ * otherwise.
+ */
+void TextWidget::UpdateDynamicTextLines(i2cDisplay *display)
+{
+    // Check if all lines are empty; if so, exit early
+    bool allEmpty = true;
+    if (_AllowEmtyTextLines) allEmpty = false; // Do not skip empty lines at the beginning
+    else                                       // Check if all lines are empty then exit early and do not display anything!
+    {
+        for (uint8_t i = 0; i < MAX_TEXT_LINES; ++i)
+        {
+            if (textLines[i]._textLen != 0)
+            {
+                allEmpty = false;
+                break;
+            }
+        }
+    }
+
+    if (!allEmpty) // Proceed only if at least one line is non-empty
+    {
+        // The display list compares the lines with the last frame, so unchanged lines are not drawn again
+        displayDynamicText(display, {&textLines[0], &textLines[1], &textLines[2],
+                                     &textLines[3], &textLines[4], &textLines[5],
+                                     &textLines[6], &textLines[7]});
+    }
+}
+
+/**
+ * @brief Append a new line of text to the widget. If the widget already has the maximum number of text lines,
+ * the oldest line will be removed. Use case: Displaying log messages or other dynamic text.
+ * IMPORTANT: This function is not checking the text size. It assumes
+ *            that the text font is default and the size is 1.
+ * @param newLine is the new line at the end of the text widget.
+ * @example appendLine( "New Line of Text");
+ */
+void TextWidget::appendLine(std::string newLine)
+{
+    if (textLines[MAX_TEXT_LINES - 1]._textLen != 0)
+    {
+        // Move the texts up by their handles, the text of the first line is dropped
+        textArena.release(textLines[0]._text);
+        for (uint8_t i = 0; i < MAX_TEXT_LINES - 1; i++)
+        {
+            textLines[i]._text = textLines[i + 1]._text;
+            textLines[i]._textLen = textLines[i + 1]._textLen;
+            textLines[i]._requestedLen = textLines[i + 1]._requestedLen;
+            textLines[i]._textHash = textLines[i + 1]._textHash;
+            textLines[i]._cutByBudget = textLines[i + 1]._cutByBudget;
+            textLines[i].scrollPos = 0;
+        }
+        textLines[MAX_TEXT_LINES - 1]._text = TextArena::NONE;
+        textLines[MAX_TEXT_LINES - 1]._textLen = 0;
+        textLines[MAX_TEXT_LINES - 1]._requestedLen = 0;
+        textLines[MAX_TEXT_LINES - 1]._textHash = DisplayList::HASH_SEED;
+        textLines[MAX_TEXT_LINES - 1]._cutByBudget = false;
+        SetDynamicTextLine(MAX_TEXT_LINES - 1, newLine.c_str());
+    }
+    else
+    {
+        for (uint8_t i = 0; i < MAX_TEXT_LINES; i++)
+        {
+            if (textLines[i]._textLen == 0)
+            {
+                SetDynamicTextLine(i, newLine.c_str());
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief get the width of the text in pixels,
+ *        considering the text size for the default font.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param text a charecter to get the width of. e.g. "X"
+ * @param textSize the size of the text
+ * @return uint16_t the width of the text in pixels
+ */
+uint16_t TextWidget::getTextWidth(i2cDisplay *display, const char *text, uint8_t textSize)
+{
+    int16_t x1, y1;
+    uint16_t w, h;
+    display->display->setTextSize(
+        textSize); // Set text size before calculating bounds
+    display->display->getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    return w;
+}
+
+/**
+ * @brief get the height of the text in pixels, considering the text size for
+ * the default font.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param text a charecter to get the height of. e.g. "X"
+ * @param textSize the size of the text
+ * @return uint16_t the height of the text in pixels
+ */
+uint16_t TextWidget::getTextHeight(i2cDisplay *display, const char *text, uint8_t textSize)
+{
+    int16_t x1, y1;
+    uint16_t w, h;
+    display->display->setTextSize(
+        textSize); // Set text size before calculating bounds
+    display->display->getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    return h;
+}
+
+/**
+ * @brief Calculate the maximum number of text lines that can be displayed on the
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param font the font to use for the calculation. Default is nullptr.
+ * @return uint16_t  the maximum number of text lines that can be displayed on the
+ */
+uint16_t TextWidget::calculateMaxTextLines(i2cDisplay *display, const GFXfont *font)
+{
+
+    if (font != nullptr) // Optional font
+    {
+        display->display->setFont(font);
+    }
+
+    int16_t x, y;
+    uint16_t textWidth, textHeight;
+
+    // Berechne die Höhe einer Beispielzeile
+    display->display->getTextBounds("X", 0, 0, &x, &y, &textWidth, &textHeight);
+
+    // Berechne die maximalen Zeilen
+    uint16_t maxTextLines = display->GetDisplayHeight() / textHeight;
+    return maxTextLines;
+}
+
+/**
+ * @brief Display the dynamic text lines on the display. This function is called
+ * in the loop function to display the dynamic text lines on the display.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param textLines is a vector of lcdText objects representing the text lines
+ * to display.
+ */
+void TextWidget::displayDynamicText(i2cDisplay *display, const std::vector<lcdText *> &textLines)
+{
+    uint32_t currentTime = millis();
+
+    // Collect the lines in the display list. Only the changed lines are drawn by commit()
+    _displayList.begin();
+    display->display->cp437(true); // Use CP437 character encoding
+
+    // Calculate the heights of the text sections
+    uint16_t totalHeightTop, totalHeightBottom, totalMiddleHeight, middleLineCount;
+    calculateTextHeights(display, textLines, totalHeightTop, totalHeightBottom, totalMiddleHeight, middleLineCount);
+
+    // Calculate available height for middle-aligned lines
+    int16_t availableMiddleHeight = display->display->height() - (totalHeightTop + totalHeightBottom);
+    int16_t middleStartY = totalHeightTop + (availableMiddleHeight - totalMiddleHeight) / 2;
+
+    // Draw each line of text
+    drawTextLines(display, textLines, totalHeightTop, totalHeightBottom, middleStartY, availableMiddleHeight, currentTime);
+
+    if (display->claim(this)) _displayList.invalidate(); // Another widget has drawn in between. Redraw all
+    _displayList.commit(display);
+
+    // Refresh display (changed areas only)
+    display->displayDirty();
+}
+
+/**
+ * @brief Calculate the heights of the top, middle, and bottom text sections.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param textLines is a vector of lcdText objects representing the text lines to display.
+ * @param totalHeightTop will store the total height of the top-aligned text.
+ * @param totalHeightBottom will store the total height of the bottom-aligned text.
+ * @param totalMiddleHeight will store the total height of the middle-aligned text.
+ * @param middleLineCount will store the count of middle-aligned lines.
+ */
+void TextWidget::calculateTextHeights(i2cDisplay *display, const std::vector<lcdText *> &textLines, uint16_t &totalHeightTop, uint16_t &totalHeightBottom, uint16_t &totalMiddleHeight, uint16_t &middleLineCount)
+{
+    totalHeightTop = 0;
+    totalHeightBottom = 0;
+    totalMiddleHeight = 0;
+    middleLineCount = 0;
+
+    for (const auto &line : textLines)
+    {
+        int16_t lineHeight = getTextHeight(display, "X", line->textSize);
+
+        if (line->alignPos & ALIGN_TOP)
+        {
+            totalHeightTop += lineHeight;
+        }
+        else if (line->alignPos & ALIGN_BOTTOM)
+        {
+            totalHeightBottom += lineHeight;
+        }
+        else if (line->alignPos & ALIGN_MIDDLE)
+        {
+            totalMiddleHeight += lineHeight;
+            ++middleLineCount;
+        }
+    }
+}
+
+/**
+ * @brief Add each line of text to the display list.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param textLines is a vector of lcdText objects representing the text lines to display.
+ * @param totalHeightTop is the total height of the top-aligned text.
+ * @param totalHeightBottom is the total height of the bottom-aligned text.
+ * @param middleStartY is the starting Y position for middle-aligned text.
+ * @param availableMiddleHeight is the available height for middle-aligned text.
+ * @param currentTime is the current time in milliseconds.
+ */
+void TextWidget::drawTextLines(i2cDisplay *display, const std::vector<lcdText *> &textLines, uint16_t totalHeightTop, uint16_t totalHeightBottom, uint16_t middleStartY, uint16_t availableMiddleHeight, uint32_t currentTime)
+{
+    for (const auto &line : textLines)
+    {
+        if (line->skipLineIfEmpty && line->_textLen == 0)
+            continue; // Skip empty lines!
+
+        // TODO check runtime!
+        handleScrolling(display, line, currentTime); // Handles scrolling text!
+
+        uint16_t cursorX = calculateCursorX(display, line);                                                                         // Calculate the X position of the cursor
+        uint16_t cursorY = calculateCursorY(display, line, totalHeightTop, totalHeightBottom, middleStartY, availableMiddleHeight); // Calculate the Y position of the cursor
+
+        const int maxChars = display->display->width() / getTextWidth(display, "X", line->textSize); // Visible characters in the line
+        const int textLen = line->_textLen;
+        const int visibleLen = line->scrollPos < textLen ? std::min(textLen - line->scrollPos, maxChars) : 0;
+
+        // The visible part is identified by the hash of the line (kept since setLineText()), the stored length
+        // and the scroll position, so the text is not hashed again in every frame
+        uint32_t contentHash = DisplayList::hash(&line->_textLen, sizeof(line->_textLen), line->_textHash);
+        contentHash = DisplayList::hash(&line->scrollPos, sizeof(line->scrollPos), contentHash);
+
+        // Empty lines are added as well, so the position in the list of the following lines does not change
+        _displayList.addText(cursorX, cursorY, line->getText() + line->scrollPos, visibleLen, line->textColor, line->bgColor, line->textSize, contentHash);
+    }
+}
+
+/**
+ * @brief Handle the scrolling of a text line.
+ *
+ * @param line is a pointer to the lcdText object representing the text line.
+ * @param currentTime is the current time in milliseconds.
+ */
+void TextWidget::handleScrolling(i2cDisplay *display, lcdText *line, uint32_t currentTime)
+{
+    // Pause scrolling at start if needed
+    if (line->pauseAtStart && line->scrollPos == 0)
+    {
+        line->_scrollTextPaused = (currentTime - line->_lastPauseTime < line->scrollPauseTime);
+    }
+
+    // Scroll text if needed and pause scrolling at the beginning if it is set
+    if (line->scrollText && line->_textLen > display->display->width() / getTextWidth(display, "X", line->textSize) && !line->_scrollTextPaused)
+    {
+        if (currentTime - line->_lastScrollTime > SCROLL_DELAY) // Scrolling speed
+        {
+            // Scroll text by one position!
+            line->scrollPos = (line->scrollPos + 1) % (line->_textLen - display->display->width() / getTextWidth(display, "X", line->textSize) + 1);
+            // Update the last scroll time
+            line->_lastScrollTime = currentTime;
+        }
+    }
+    else
+    {
+        line->scrollPos = 0; // Reset scroll position if text is not scrolling!
+    }
+}
+
+/**
+ * @brief Calculate the X position of the cursor for a text line.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param line is a pointer to the lcdText object representing the text line.
+ * @return the X position of the cursor.
+ */
+uint16_t TextWidget::calculateCursorX(i2cDisplay *display, const lcdText *line)
+{
+    uint16_t cursorX = line->startPosX;
+
+    if (line->alignPos & ALIGN_CENTER) // Try to center the text
+    {
+        cursorX = (display->display->width() - getTextWidth(display, line->getText(), line->textSize)) / 2;
+    }
+    else if (line->alignPos & ALIGN_RIGHT) // Align to the right
+    {
+        cursorX = display->display->width() - getTextWidth(display, line->getText(), line->textSize);
+    }
+    else if (line->alignPos & ALIGN_LEFT)
+    {
+        cursorX = 0; // Align to the left
+    }
+
+    return cursorX;
+}
+
+/**
+ * @brief Calculate the Y position of the cursor for a text line.
+ *
+ * @param display pointer to the i2cDisplay object.
+ * @param line is a pointer to the lcdText object representing the text line.
+ * @param totalHeightTop is the total height of the top-aligned text.
+ * @param totalHeightBottom is the total height of the bottom-aligned text.
+ * @param middleStartY is the starting Y position for middle-aligned text.
+ * @param availableMiddleHeight is the available height for middle-aligned text.
+ * @return the Y position of the cursor.
+ */
+uint16_t TextWidget::calculateCursorY(i2cDisplay *display, const lcdText *line, uint16_t &totalHeightTop, uint16_t &totalHeightBottom, uint16_t &middleStartY, uint16_t availableMiddleHeight)
+{
+    uint16_t cursorY = 0;
+    const uint16_t lineHeight = getTextHeight(display, "X", line->textSize);
+
+    if (line->alignPos & ALIGN_TOP)
+    {
+        cursorY = totalHeightTop;
+        totalHeightTop += lineHeight;
+    }
+    else if (line->alignPos & ALIGN_BOTTOM)
+    {
+        totalHeightBottom += lineHeight;
+        cursorY = display->display->height() - totalHeightBottom;
+    }
+    else if (line->alignPos & ALIGN_MIDDLE && availableMiddleHeight >= lineHeight)
+    {
+        cursorY = middleStartY;
+        middleStartY += lineHeight;
+    }
+    else
+    {
+        cursorY = totalHeightTop; // Default to top alignment if no specific alignment is set
+        totalHeightTop += lineHeight;
+    }
+
+    return cursorY;
+}
+
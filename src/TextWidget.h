@@ -0,0 +1,139 @@
+#pragma once
+/**
+ * @file        TextWidget.h
+ * @brief       Widget for dynamic text lines
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ */
+#include "Widget.h"
+#include "DisplayList.h"
+#include "TextArena.h"
+#include "TextFormat.h"
+#include <functional>
+
+// Maximum 250 characters per line for scrolling text. The texts are stored in the textArena
+#define MAX_CHARS_PER_LINE_SCROLL 250
+#define SCROLL_DELAY 250 // Scrolling speed (in milliseconds)
+#define TEXT_WIDGET_ARENA_BUDGET 768 // Maximum bytes of the textArena for the texts of one TextWidget. Longer texts are shortened
+
+// Default settings for the display
+#define MAX_TEXT_LINES 8 // Maximum number of text lines on a 128x64 display with default font
+
+// Text alignment options
+enum TextAlign
+{
+    LEFT,
+    CENTER,
+    RIGHT
+}; // Top, Middle, Bottom to be added later
+
+enum TextDynamicAlign : uint8_t
+{
+    ALIGN_LEFT = 0x01,   // Align text in the line to the left
+    ALIGN_CENTER = 0x02, // Align text in the line to the center
+    ALIGN_RIGHT = 0x04,  // Align text in the line to the right
+    ALIGN_TOP = 0x10,    // Align text in the screen to the top, with calculated spacing
+    ALIGN_MIDDLE = 0x20, // Align text in the screen to the middle with calculated spacing
+    ALIGN_BOTTOM = 0x40  // Align text in the screen to the bottom with calculated spacing
+};
+
+// lcdText struct for dynamic text lines
+struct lcdText
+{
+    int16_t scrollPos = 0;                  // Current scroll position
+    uint16_t startPosY = 0;                 // Y Start position for header
+    uint16_t startPosX = 0;                 // X Start position for header
+    uint16_t textColor = SSD1306_WHITE;     // Text color is either white or black
+    uint16_t bgColor = SSD1306_BLACK;       // Background color is either white or black
+    TextDynamicAlign alignPos = ALIGN_LEFT; // Text alignment. Default ALIGN_LEFT. Can be combined with | operator. E.g. ALIGN_CENTER | ALIGN_TOP.
+                                            // Possible values: ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT, ALIGN_TOP, ALIGN_MIDDLE, ALIGN_BOTTOM
+    uint8_t textSize = 1;                   // Text size. Default is 1. Can be 1, 2, 3, 4
+    bool skipLineIfEmpty = false;           // Skip line if empty. Next non-empty line will be displayed in the same position
+
+    // Scrolling text settings
+    bool scrollText = true;          // Flag to enable scrolling text
+    bool pauseAtStart = false;       // Flag to pause scrolling text at start
+    uint16_t scrollPauseTime = 2000; // Time to pause scrolling text at start
+    bool _scrollTextPaused = false;  // Flag to pause scrolling text
+    ulong _lastPauseTime = 0;        // Time tracking for scrolling
+    ulong _lastScrollTime = 0;       // Time tracking for scrolling
+
+    // Change detection. Updated by the TextWidget when the text is set, so use SetDynamicTextLine() to change the text
+    uint32_t _textHash = DisplayList::HASH_SEED; // Hash of the requested text, also if it was shortened
+    uint16_t _requestedLen = 0;                  // Length of the requested text. Larger than _textLen if it was shortened
+    uint16_t _textLen = 0;                       // Length of the stored text
+    bool _cutByBudget = false;                   // Shortened to the budget of the widget. Not stored again until the text changes
+
+    TextArena::Handle _text = TextArena::NONE; // Text of the line in the textArena
+
+    inline const char *getText() const { return textArena.get(_text); } // Text of the line. Only valid until the next text is set
+};
+
+// Overload | operator for TextDynamicAlign
+inline TextDynamicAlign operator|(TextDynamicAlign lhs, TextDynamicAlign rhs)
+{
+    return static_cast<TextDynamicAlign>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+}
+
+class TextWidget : public Widget
+{
+  private:
+    // Text lines for dynamic text mode
+    bool _AllowEmtyTextLines = false; // Flag to enable initial start with empty lines. Default is false. I.e. to fill lines later
+
+    uint16_t getTextWidth(i2cDisplay *display, const char *text, uint8_t textSize);     // Get the width of the text in pixels
+    uint16_t getTextHeight(i2cDisplay *display, const char *text, uint8_t textSize);    // Get the height of the text in pixels
+    uint16_t calculateMaxTextLines(i2cDisplay *display, const GFXfont *font = nullptr); // Calculate the maximum number of text lines
+    bool setLineText(lcdText *sText, const char *text);                                 // Store the text, its length and the requested hash. True if the text changed
+    void displayDynamicText(i2cDisplay *display, const std::vector<lcdText *> &lines);  // Display the dynamic text on the display
+    void InitDynamicTextLines();                                                        // Initialize the dynamic text lines with default settings
+    void UpdateDynamicTextLines(i2cDisplay *display);                                   // Update the dynamic text lines on the display
+
+    // Helper functions for displayDynamicText
+    void calculateTextHeights(i2cDisplay *display, const std::vector<lcdText *> &textLines, uint16_t &totalHeightTop, uint16_t &totalHeightBottom, uint16_t &totalMiddleHeight, uint16_t &middleLineCount);             // Calculate the heights of the text sections
+    void drawTextLines(i2cDisplay *display, const std::vector<lcdText *> &textLines, uint16_t totalHeightTop, uint16_t totalHeightBottom, uint16_t middleStartY, uint16_t availableMiddleHeight, uint32_t currentTime); // Draw each line of text
+    void handleScrolling(i2cDisplay *display, lcdText *line, uint32_t currentTime);                                                                                                                                     // Handle the scrolling of a text line
+    uint16_t calculateCursorX(i2cDisplay *display, const lcdText *line);                                                                                                                                                // Calculate the X position of the cursor for a text line
+    uint16_t calculateCursorY(i2cDisplay *display, const lcdText *line, uint16_t &totalHeightTop, uint16_t &totalHeightBottom, uint16_t &middleStartY, uint16_t availableMiddleHeight);                                 // Calculate the Y position of the cursor for a text line
+
+    /** Retained content of the text lines. Only changed lines are drawn and sent */
+    DisplayList _displayList;
+
+    // Data binding of a text line. The provider is only called while the widget is on screen
+    struct LineBinding
+    {
+        std::function<void(char *text, size_t size)> provider; // Writes the text of the line into the buffer
+        uint32_t interval;                                      // Refresh interval in milliseconds
+        uint32_t lastRefresh;                                   // Time of the last refresh
+        uint8_t lineIndex;                                      // Bound line
+        bool refreshed;                                         // False until the first refresh
+    };
+    std::vector<LineBinding> _bindings; // Bound lines. Empty for static texts
+
+  protected:
+    void drawWidget(i2cDisplay *display) override; // Draw the text lines
+
+  public:
+    TextWidget();                                  // Constructor
+    ~TextWidget();                                 // Destructor. Frees the texts in the textArena
+    TextWidget(const TextWidget &) = delete;       // The texts in the textArena are owned by the widget
+    TextWidget &operator=(const TextWidget &) = delete;
+
+    // Get the text widget, if the widget is one. Otherwise nullptr
+    static inline TextWidget *from(Widget *widget) { return (widget != nullptr && widget->getDisplayMode() == DisplayMode::DYNAMIC_TEXT) ? static_cast<TextWidget *>(widget) : nullptr; }
+
+    inline void setAllowEmptyTextLines(bool empty) { _AllowEmtyTextLines = empty; } // Set the initial empty text lines flag
+    void appendLine(std::string newLine);                                            // Append a new line to the widget. Use case is console output
+    void SetDynamicTextLines(const std::vector<const char *> &lines);                // Set the text for multiple lines in the widget
+    void SetDynamicTextLine(size_t lineIndex, const char *text);                     // Set the text for a specific line in the widget
+    void SetDynamicTextLinef(size_t lineIndex, const char *format, ...)              // Set the text for a specific line, printf-style
+        __attribute__((format(printf, 3, 4)));
+    typedef std::function<void(char *text, size_t size)> LineProvider;               // Writes the text of a bound line, e.g. with snprintf()
+    void BindDynamicTextLine(size_t lineIndex, LineProvider provider, uint32_t intervalMs = 1000); // Bind a line to a provider, refreshed while the widget is shown
+    void UnbindDynamicTextLine(size_t lineIndex);                                    // Remove the binding of a line. The last text stays
+    void refreshBindings(uint32_t now) override;                                     // Call the providers of the due bound lines
+    lcdText textLines[MAX_TEXT_LINES];                                               // Fixed array for text lines
+    void EmptyLines();                                                               // Clear all lines
+}; // End of class TextWidget
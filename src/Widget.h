@@ -6,6 +6,16 @@
  * @date        2024-11-27
  * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
  *              Licensed under GNU GPL v3.0
+ *
+ * Widget is the small common interface of all widgets. Every display mode has its own widget class, which only
+ * holds the state this mode needs (see Widgets.h):
+ *   - TextWidget:          Dynamic text lines (DYNAMIC_TEXT)
+ *   - ConsoleWidget:       Console lines with history and scrollback (CONSOLE)
+ *   - OpenKNXLogoWidget:   OpenKNX logo with uptime and address (OPENKNX_LOGO)
+ *   - BootLogoWidget:      Boot logo (BOOT_LOGO)
+ *   - ProgModeWidget:      Programming mode (PROG_MODE)
+ *   - QRCodeWidget:        QR code (QR_CODE)
+ *   - *Screensaver:        Screensavers and the OpenKNX team intro (SCREEN_SAVER_*, OPENKNX_TEAM_INTRO)
  */
 
 // WIDGETS
@@ -15,88 +25,18 @@
 
 #include "i2c-Display.h"  // Include 1st
 #include "DisplayIcons.h" // Include 2nd
+#include "FastText.h"
 #include "OpenKNX/Stat/RuntimeStat.h"
 
-#ifdef QRCODE_WIDGET
-    #include "QRCodeGen.hpp" // Include 3rd
-#endif
-
-// Maximum 100 characters per line for scrolling text
-#define MAX_CHARS_PER_LINE_SCROLL 100
-#define SCROLL_DELAY 250 // Scrolling speed (in milliseconds)
-
-// Default widget settings
-#define PROG_MODE_BLINK_DELAY 500 // Blink delay for "Prog Mode active" text
-#define BOOT_LOGO_TIMEOUT 5000    // Timeout for showing the boot logo
-
-// Default settings for the display
-#define MAX_TEXT_LINES 8 // Maximum number of text lines on a 128x64 display with default font
-
-// Matrix screensaver settings
-#ifdef MATRIX_SCREENSAVER
-    #define COLUMN_WIDTH 8 // Width of a column in pixels
-    #define FALL_SPEED 50  // Falling speed in milliseconds
-    #define MAX_DROPS 5    // Maximum number of falling characters per column
-#endif
-
 #define WIDGET_INACTIVE 0 // Widget is inactive
 
-// Text alignment options
-enum TextAlign
-{
-    LEFT,
-    CENTER,
-    RIGHT
-}; // Top, Middle, Bottom to be added later
-
-enum TextDynamicAlign : uint8_t
-{
-    ALIGN_LEFT = 0x01,   // Align text in the line to the left
-    ALIGN_CENTER = 0x02, // Align text in the line to the center
-    ALIGN_RIGHT = 0x04,  // Align text in the line to the right
-    ALIGN_TOP = 0x10,    // Align text in the screen to the top, with calculated spacing
-    ALIGN_MIDDLE = 0x20, // Align text in the screen to the middle with calculated spacing
-    ALIGN_BOTTOM = 0x40  // Align text in the screen to the bottom with calculated spacing
-};
-
-// lcdText struct for dynamic text lines
-struct lcdText
-{
-    int16_t scrollPos = 0;                  // Current scroll position
-    uint16_t startPosY = 0;                 // Y Start position for header
-    uint16_t startPosX = 0;                 // X Start position for header
-    uint16_t textColor = SSD1306_WHITE;     // Text color is either white or black
-    uint16_t bgColor = SSD1306_BLACK;       // Background color is either white or black
-    TextDynamicAlign alignPos = ALIGN_LEFT; // Text alignment. Default ALIGN_LEFT. Can be combined with | operator. E.g. ALIGN_CENTER | ALIGN_TOP.
-                                            // Possible values: ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT, ALIGN_TOP, ALIGN_MIDDLE, ALIGN_BOTTOM
-    uint8_t textSize = 1;                   // Text size. Default is 1. Can be 1, 2, 3, 4
-    bool skipLineIfEmpty = false;           // Skip line if empty. Next non-empty line will be displayed in the same position
-
-    // Scrolling text settings
-    bool scrollText = true;          // Flag to enable scrolling text
-    bool pauseAtStart = false;       // Flag to pause scrolling text at start
-    uint16_t scrollPauseTime = 2000; // Time to pause scrolling text at start
-    bool _scrollTextPaused = false;  // Flag to pause scrolling text
-    ulong _lastPauseTime = 0;        // Time tracking for scrolling
-    ulong _lastScrollTime = 0;       // Time tracking for scrolling
-
-    // Text for scrolling
-    char _prevText[MAX_CHARS_PER_LINE_SCROLL + 1] = ""; // Previous text for scrolling
-    char text[MAX_CHARS_PER_LINE_SCROLL + 1] = "";      // Default text for the line
-};
-
-// Overload | operator for TextDynamicAlign
-inline TextDynamicAlign operator|(TextDynamicAlign lhs, TextDynamicAlign rhs)
-{
-    return static_cast<TextDynamicAlign>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
-}
-
 class Widget
 {
   public:
     enum class DisplayMode
     {
         DYNAMIC_TEXT,   // Dynamic text lines depending on the lines of the display and their position or settings
+        CONSOLE,        // Console with history and scrollback
         ICON_WITH_TEXT, // Icon with text mode
         OPENKNX_LOGO,   // OpenKNX logo
         PROG_MODE,      // Programming mode
@@ -117,93 +57,24 @@ class Widget
         BOOT_LOGO // Boot logo
     };
 
-  private:
-    DisplayMode currentDisplayMode; // Current display mode for the widgets. Default is dynamic text mode
-    const uint8_t *iconBitmap;      // Bitmap for icon with text mode
-
-    // Text lines for dynamic text mode
-    bool _AllowEmtyTextLines = false; // Flag to enable initial start with empty lines. Default is false. I.e. to fill lines later
+    static Widget *create(DisplayMode mode); // Create the widget for a display mode. nullptr if the mode is not supported
 
-    uint16_t getTextWidth(i2cDisplay *display, const char *text, uint8_t textSize);             // Get the width of the text in pixels
-    uint16_t getTextHeight(i2cDisplay *display, const char *text, uint8_t textSize);            // Get the height of the text in pixels
-    uint16_t calculateMaxTextLines(i2cDisplay *display, const GFXfont *font = nullptr);         // Calculate the maximum number of text lines
-    void writeScrolledText(i2cDisplay *display, const char *text, int scrollPos, int maxChars); // Write the scrolled text to the display
-    bool checkAndUpdateLcdText(lcdText *sText);                                                 // Check and update the text on the display
-    void displayDynamicText(i2cDisplay *display, const std::vector<lcdText *> &lines);          // Display the dynamic text on the display
-    void InitDynamicTextLines();                                                                // Initialize the dynamic text lines with default settings
-    void UpdateDynamicTextLines(i2cDisplay *display);                                           // Update the dynamic text lines on the display
-
-    // Helper functions for displayDynamicText
-    void calculateTextHeights(i2cDisplay *display, const std::vector<lcdText *> &textLines, uint16_t &totalHeightTop, uint16_t &totalHeightBottom, uint16_t &totalMiddleHeight, uint16_t &middleLineCount);             // Calculate the heights of the text sections
-    void drawTextLines(i2cDisplay *display, const std::vector<lcdText *> &textLines, uint16_t totalHeightTop, uint16_t totalHeightBottom, uint16_t middleStartY, uint16_t availableMiddleHeight, uint32_t currentTime); // Draw each line of text
-    void handleScrolling(i2cDisplay *display, lcdText *line, uint32_t currentTime);                                                                                                                                     // Handle the scrolling of a text line
-    uint16_t calculateCursorX(i2cDisplay *display, const lcdText *line);                                                                                                                                                // Calculate the X position of the cursor for a text line
-    uint16_t calculateCursorY(i2cDisplay *display, const lcdText *line, uint16_t &totalHeightTop, uint16_t &totalHeightBottom, uint16_t &middleStartY, uint16_t availableMiddleHeight);                                 // Calculate the Y position of the cursor for a text line
-
-    /** state of partial drawing:
-     * 0    = no drawing / done, 
-     * 1..n = drawing step
-     */ 
-    uint8_t _drawStep = 1;
-
-    /** state of partial drawing:
-     * 0=no drawing / done, 
-     * 1=clear, 
-     * 2=partial draw image, 
-     * 3=start sending to display, 
-     */ 
-    uint8_t _drawBootlogo = 1; // TODO check using enum
-
-    /** Row to start drawing in one loop() call */
-    uint8_t _yStart = 0;
-
-    // Boot logo and OpenKNX logo
-    void OpenKNXLogo(i2cDisplay *display);  // Show the OpenKNX logo on the display
-    void ShowBootLogo(i2cDisplay *display); // Show the boot logo on the display
-
-    // Programming mode
-    ulong _showProgrammingMode_last_Blink = 0;     // Last time the blink state was updated
-    bool _showProgrammingMode_showProgMode = true; // Toggle between showing/hiding "Prog Mode active"
-    void showProgrammingMode(i2cDisplay *display); // Show the programming mode on the display
-
-#ifdef MATRIX_SCREENSAVER
-    // Matrix screensaver
-    ulong _lastUpdateScreenSaver = 0;                                          // Last time the screensaver was updated
-    void showMatrixScreensaver(i2cDisplay *display);                           // Show the matrix screensaver on the display
-    void showPongScreensaver(i2cDisplay *display);                             // Show the pong screensaver on the display
-    void showClockScreensaver(i2cDisplay *display, bool rounded = false);      // Show the clock screensaver on the display
-    void showRainfallScreensaver(i2cDisplay *display, uint8_t intensity = 10); // Show the rainfall screensaver on the display
-    void showMatrixScreensaverP(i2cDisplay *display, uint8_t intensity = 10);  // Show the matrix screensaver on the display
-    void show3DCubeScreensaver(i2cDisplay *display);                           // Show the 3D cube screensaver on the display
-    void showStarfieldScreensaver(i2cDisplay *display, uint8_t intensity = 8); // Show the starfield screensaver on the display
-    void showLifeScreensaver(i2cDisplay *display);                             // Show the life screensaver on the display
-
-    void showOpenKNXTeamIntro(i2cDisplay *display, const std::vector<std::string> &names, const std::string &logoText); // Show the OpenKNX intro on the display
-    std::vector<std::string> developerNames = {"traxanos", "jeff25", "Ing-Dom", "mumpf", "thewhobox", "willisurf", "cornelius-koepp", "ab-tools", "GeminiServer", "mgeramb", "Smart-MF"};
-    std::string logoText = "Powered by OpenKNX";
-
-#endif
-#ifdef QRCODE_WIDGET
-    void showQRCode(i2cDisplay *display); // Show the QR code on the display
-#endif                                    // QRCODE_WIDGET
-
-  public:
-    inline void setAllowEmptyTextLines(bool empty) { _AllowEmtyTextLines = empty; } // Set the initial empty text lines flag
-
-#ifdef QRCODE_WIDGET
-    QRCodeWidget qrCodeWidget;            // QR Code Widget
-#endif                                    // QRCODE_WIDGET
-    void appendLine(std::string newLine); // Append a new line to the widget. Only works for dynamic text mode and use case is console output
-
-    Widget(DisplayMode mode = DisplayMode::DYNAMIC_TEXT);             // Constructor
-    ~Widget();                                                        // Destructor
-    void draw(i2cDisplay *display);                                   // Update the display with the current display mode
-    void SetDynamicTextLines(const std::vector<const char *> &lines); // Set the text for multiple lines in the widget
-    void SetDynamicTextLine(size_t lineIndex, const char *text);      // Set the text for a specific line in the widget
-    lcdText textLines[MAX_TEXT_LINES];                                // Fixed array for text lines
-    void EmptyLines();                                                // Clear all lines
+    virtual ~Widget() {}                                                    // Destructor
+    void draw(i2cDisplay *display);                                         // Update the display with the widget
+    inline DisplayMode getDisplayMode() const { return _displayMode; }      // Display mode of the widget
+    static inline void setRenderBudget(uint32_t budgetUs) { _renderBudgetUs = budgetUs; } // Set the time budget for drawing per loop() call
+    virtual void refreshBindings(uint32_t now) {}                           // Evaluate the due data bindings. Only called for the widget on screen
 //  private:
 #ifdef OPENKNX_RUNTIME_STAT
     OpenKNX::Stat::RuntimeStat _WidgetRutimeStat;
 #endif
-}; // End of class Widget
\ No newline at end of file
+
+  protected:
+    Widget(DisplayMode mode) : _displayMode(mode) {} // Constructor for the derived widgets
+    virtual void drawWidget(i2cDisplay *display) = 0; // Draw the widget. Called by draw() with a valid display
+
+    static uint32_t _renderBudgetUs; // Time budget of the time-sliced widgets per draw() call. Shared by all widgets
+
+  private:
+    const DisplayMode _displayMode; // Display mode of the widget
+}; // End of class Widget
@@ -0,0 +1,18 @@
+#pragma once
+/**
+ * @file        Widgets.h
+ * @brief       All widgets of the display module
+ * @version     0.0.1
+ * @date        2024-11-27
+ * @copyright   Copyright (c) 2024, Erkan Çolak (erkan@çolak.de)
+ *              Licensed under GNU GPL v3.0
+ */
+#include "Widget.h"
+#include "TextWidget.h"
+#include "ConsoleWidget.h"
+#include "LogoWidgets.h"
+#include "Screensavers.h"
+
+#ifdef QRCODE_WIDGET
+    #include "QRCodeGen.hpp"
+#endif
@@ -300,6 +300,7 @@ void i2cDisplay::SetDisplayPreCharge(uint8_t precharge) // Set the display prech
  */
 void i2cDisplay::displayBuff()
 {
+    _owner = nullptr; // The buffer was drawn without claim()
     if (__loopColumnMethod)
     {
         // start sending to display on change only
@@ -339,6 +340,100 @@ void i2cDisplay::displayBuff()
     }
 }
 
+/**
+ * @brief Mark an area of the display buffer as changed. The marked columns of each page are sent with
+ *        displayDirty(). The area is clipped to the display.
+ * @param x left column of the area
+ * @param y top row of the area
+ * @param w width of the area
+ * @param h height of the area
+ */
+void i2cDisplay::markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    const int16_t x0 = MAX(x, 0);
+    const int16_t x1 = MIN(x + w - 1, lcdSettings.width - 1);
+    const int16_t y0 = MAX(y, 0);
+    const int16_t y1 = MIN(y + h - 1, lcdSettings.height - 1);
+    if (x0 > x1 || y0 > y1) return; // Outside of the display
+
+    for (int page = y0 / 8; page <= y1 / 8 && page < I2C_DISPLAY_MAX_PAGES; page++)
+    {
+        if (_dirtyFrom[page] == 0xff) // First area in this page
+        {
+            _dirtyFrom[page] = x0;
+            _dirtyTo[page] = x1;
+        }
+        else
+        {
+            if (x0 < _dirtyFrom[page]) _dirtyFrom[page] = x0;
+            if (x1 > _dirtyTo[page]) _dirtyTo[page] = x1;
+        }
+    }
+}
+
+/**
+ * @brief Send the areas marked with markDirty() to the display. Within the marked columns of a page, only the
+ *        changed bytes are sent. Unlike displayBuff(), the rest of the buffer is not compared.
+ *        Falls back to displayBuff() for the loop column method and for displays with more pages than tracked.
+ */
+void i2cDisplay::displayDirty()
+{
+    const int pages = lcdSettings.height / 8;
+    if (__loopColumnMethod || pages > I2C_DISPLAY_MAX_PAGES)
+    {
+        const void *owner = _owner;
+        displayBuff();
+        _owner = owner; // The buffer is still owned by the caller
+    }
+    else
+    {
+        const uint8_t *buffer = display->getBuffer();
+        for (int page = 0; page < pages; page++)
+        {
+            if (_dirtyFrom[page] == 0xff) continue; // Nothing marked in this page
+
+            int startColumn = lcdSettings.width;
+            int endColumn = -1;
+            for (int col = _dirtyFrom[page]; col <= _dirtyTo[page]; col++)
+            {
+                size_t index = page * lcdSettings.width + col;
+                _curDispBuffer[index] = buffer[index];
+                if (_curDispBuffer[index] != _prevDispBuffer[index])
+                {
+                    if (col < startColumn) startColumn = col;
+                    endColumn = col;
+                    _prevDispBuffer[index] = _curDispBuffer[index];
+                }
+            }
+            updatePage(page, startColumn, endColumn); // Does nothing, if no byte has changed
+        }
+    }
+    memset(_dirtyFrom, 0xff, sizeof(_dirtyFrom));
+}
+
+/**
+ * @brief Claim the display buffer for a retained-mode drawer (e.g. a widget with a display list). The buffer
+ *        content only belongs to the owner, as long as nobody else draws and sends it with displayBuff().
+ * @param owner the claiming object, e.g. the widget
+ * @return true if the buffer was drawn by someone else since the last claim, so the owner has to redraw everything
+ */
+bool i2cDisplay::claim(const void *owner)
+{
+    const bool changed = (_owner != owner);
+    _owner = owner;
+    return changed;
+}
+
+/**
+ * @brief Release the display buffer. Must be called before the owner is deleted, since a new object at the same
+ *        address would otherwise find the buffer still claimed and skip its first full redraw.
+ * @param owner the object which claimed the buffer. Nothing is done, if the buffer is owned by someone else
+ */
+void i2cDisplay::release(const void *owner)
+{
+    if (_owner == owner) _owner = nullptr;
+}
+
 /**
  * @brief Initialize the display buffer. This function will allocate memory for the current and previous display buffer.
  *        The current display buffer will hold the current display data and the previous display buffer will hold the
@@ -361,6 +456,8 @@ bool i2cDisplay::initDisplayBuffer()
     }
     memset(_curDispBuffer, 0, _sizeDispBuff);  // Clear the current display buffer
     memset(_prevDispBuffer, 0, _sizeDispBuff); // Clear the previous display buffer
+    memset(_dirtyFrom, 0xff, sizeof(_dirtyFrom));  // Nothing marked for displayDirty()
+    memset(_dirtyTo, 0, sizeof(_dirtyTo));
 
     return true; // Allocation successful
 }
@@ -12,6 +12,8 @@
 #include <Adafruit_SSD1306.h>
 #include <Wire.h>
 
+#define I2C_DISPLAY_MAX_PAGES 8 // Maximum number of pages (height / 8) for the tracking of dirty areas
+
 class i2cDisplay
 {
   public:
@@ -60,6 +62,24 @@ class i2cDisplay
     void SetDisplayClockDiv(uint8_t clockdiv);                 // Set the display clock division
     void SetDisplayPreCharge(uint8_t precharge);               // Set the display precharge
     void displayBuff();                                        // Funktion, die den Puffer mit dem aktuellen Zustand vergleicht und nur geänderte Bereiche sendet
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h); // Mark an area of the buffer as changed, for displayDirty()
+    inline void markDirtyPixel(int16_t x, int16_t y)            // markDirty() for a single pixel. It must be on the display!
+    {
+        const uint8_t page = y / 8;
+        if (_dirtyFrom[page] == 0xff) // First area in this page
+        {
+            _dirtyFrom[page] = x;
+            _dirtyTo[page] = x;
+        }
+        else
+        {
+            if (x < _dirtyFrom[page]) _dirtyFrom[page] = x;
+            if (x > _dirtyTo[page]) _dirtyTo[page] = x;
+        }
+    }
+    void displayDirty();                                       // Send only the areas marked with markDirty()
+    bool claim(const void* owner);                             // Claim the buffer. Returns true if it was changed by someone else since the last claim
+    void release(const void* owner);                           // Give up the buffer, e.g. before the owner is deleted
 
 
     inline void __setLoopColumnMethod(bool loopColumnMethod) { __loopColumnMethod = loopColumnMethod; } // Set the loop column method
@@ -69,6 +89,10 @@ class i2cDisplay
     uint8_t* _curDispBuffer;  // Buffer size!
     uint8_t* _prevDispBuffer; // Buffer size!
 
+    uint8_t _dirtyFrom[I2C_DISPLAY_MAX_PAGES]; // First dirty column per page. 0xff if the page is clean
+    uint8_t _dirtyTo[I2C_DISPLAY_MAX_PAGES];   // Last dirty column per page
+    const void* _owner = nullptr;              // Owner of the buffer content, see claim()
+
     // __TESTING__
     bool __loopColumnMethod = false; // Enable the loop column for partial display updates. Default is false. 
     /**
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Encoder for the run-length compressed bitmaps of OFM-DeviceDisplay (see src/RleBitmap.h).
+
+Reads a bitmap from a C/C++ source file (image2cpp output: horizontal, 1 bit per pixel, MSB first) and prints
+the token stream as C array, ready to be pasted into DisplayIcons.h:
+
+    python3 tools/rle_encode.py src/DisplayIcons.h logo_OpenKNX 106 64
+
+Every pixel is stored as the XOR with the pixel directly above it (the first row against 0). The resulting bit
+stream is written as tokens:
+
+    1cnnnnnn : Run of (nnnnnn + 1) pixels (1..64) with the value c
+    0bbbbbbb : Literal of 7 pixels, first pixel in bit 6
+
+Use --check to compare the result with an existing <name>_rle array in the same file, e.g. after changing the
+bitmap or the encoder:
+
+    python3 tools/rle_encode.py src/DisplayIcons.h logo_OpenKNX 106 64 --check
+"""
+import argparse
+import re
+import sys
+
+MIN_RUN = 7  # Shorter runs are stored as literals
+MAX_RUN = 64 # Longest run of a token
+
+
+def read_array(source, name):
+    """Get the bytes of the array `name` from the source text."""
+    match = re.search(r"\b%s\[\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\};" % re.escape(name), source, re.S)
+    if match is None:
+        sys.exit("Array '%s' not found" % name)
+    body = re.sub(r"//.*", "", match.group(1))
+    body = re.sub(r"/\*.*?\*/", "", body, flags=re.S)
+    return [int(value, 0) for value in re.findall(r"0[bBxX][0-9a-fA-F]+|\d+", body)]
+
+
+def pixels(data, width, height):
+    """Unpack the bitmap (rows padded to whole bytes) into a list of pixels, row by row."""
+    row_bytes = (width + 7) // 8
+    if len(data) < row_bytes * height:
+        sys.exit("Bitmap too small: %d bytes for %dx%d pixels" % (len(data), width, height))
+    return [(data[y * row_bytes + x // 8] >> (7 - (x & 7))) & 1 for y in range(height) for x in range(width)]
+
+
+def encode(pixel_list, width):
+    """Encode the pixels into the token stream."""
+    delta = [pixel_list[i] ^ (pixel_list[i - width] if i >= width else 0) for i in range(len(pixel_list))]
+    tokens = []
+    i = 0
+    while i < len(delta):
+        run = 1
+        while i + run < len(delta) and delta[i + run] == delta[i] and run < MAX_RUN:
+            run += 1
+        if run >= MIN_RUN or i + run == len(delta):  # Run token, also for the rest of the image
+            tokens.append(0x80 | (delta[i] << 6) | (run - 1))
+            i += run
+        else:  # Literal token. Missing pixels at the end are 0
+            bits = 0
+            for k in range(7):
+                bits |= (delta[i + k] if i + k < len(delta) else 0) << (6 - k)
+            tokens.append(bits)
+            i += 7
+    return tokens
+
+
+def decode(tokens, width, count):
+    """Decode the token stream like RleDecoder, to verify the encoder."""
+    delta = []
+    for token in tokens:
+        if token & 0x80:
+            delta += [(token >> 6) & 1] * ((token & 0x3F) + 1)
+        else:
+            delta += [(token >> (6 - k)) & 1 for k in range(7)]
+    result = []
+    for i in range(count):
+        result.append(delta[i] ^ (result[i - width] if i >= width else 0))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run-length encode a monochrome bitmap for RleDecoder")
+    parser.add_argument("file", help="C/C++ source with the bitmap array")
+    parser.add_argument("name", help="Name of the bitmap array")
+    parser.add_argument("width", type=int, help="Width of the bitmap in pixels")
+    parser.add_argument("height", type=int, help="Height of the bitmap in pixels")
+    parser.add_argument("--check", action="store_true", help="Compare with the array <name>_rle in the file")
+    args = parser.parse_args()
+
+    with open(args.file, encoding="utf-8") as f:
+        source = f.read()
+
+    data = read_array(source, args.name)
+    pixel_list = pixels(data, args.width, args.height)
+    tokens = encode(pixel_list, args.width)
+    if decode(tokens, args.width, len(pixel_list)) != pixel_list:
+        sys.exit("Internal error: the token stream does not decode to the bitmap")
+
+    if args.check:
+        existing = read_array(source, args.name + "_rle")
+        if existing != tokens:
+            sys.exit("%s_rle differs from the encoded bitmap (%d instead of %d bytes)" % (args.name, len(existing), len(tokens)))
+        print("%s_rle is up to date (%d bytes)" % (args.name, len(tokens)))
+        return
+
+    print("// %s as run-length compressed asset (see RleBitmap.h). %d instead of %d bytes" % (args.name, len(tokens), (args.width + 7) // 8 * args.height))
+    print("static const unsigned char PROGMEM %s_rle[] = {" % args.name)
+    for i in range(0, len(tokens), 16):
+        print("    " + ", ".join("0x%02X" % value for value in tokens[i:i + 16]) + ",")
+    print("};")
+
+
+if __name__ == "__main__":
+    main()